@@ -0,0 +1,256 @@
+#include "AimTable.h"
+#include "Game.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+/*
+------------------------------------------------------------------------------
+ AimTable.cpp  –  Construção, consulta e serialização da tabela balística
+------------------------------------------------------------------------------*/
+
+// ╔═══════════════════════════════════════════════════════════════════════════╗
+// ║                         Dimensões da Grade                                ║
+// ╚═══════════════════════════════════════════════════════════════════════════╝
+
+namespace
+{
+	// Faixas de lançamento: ponto de disparo = pos.x + 0.5 dentro dos limites
+	// de movimento de cada jogador (ver applyInput).
+	constexpr float kLaunchMin[2] = {-9.5f, 6.5f};
+	constexpr float kLaunchStep = 0.5f;
+	constexpr int kLaunches = 9; // −9.5..−5.5 (a faixa do Jogador 2 é menor)
+	constexpr float kLaunchY = 1.5f;
+
+	constexpr float kAngleStep = 1.0f;
+	constexpr int kAngles = 91; // 0..90°
+	constexpr float kPowerMin = 1.0f;
+	constexpr float kPowerStep = 0.5f;
+	constexpr int kPowers = 39; // 1..20
+
+	// Alvos: X da arena inteira, altura do centro dos jogadores.
+	constexpr float kTargetStep = 0.25f;
+	constexpr int kTargets = static_cast<int>((kArenaMaxX - kArenaMinX) / kTargetStep) + 1;
+	constexpr float kTargetY = 1.5f;
+	constexpr float kTargetTolerance = 0.25f;
+
+	constexpr float kPosScale = 1000.0f; // int16 → ±32.7 unidades
+	constexpr std::int16_t kNoCross = INT16_MIN;
+	constexpr std::uint16_t kNoAim = 0xFFFF;
+
+	constexpr char kMagic[4] = {'G', 'A', 'I', 'M'};
+	constexpr std::uint32_t kVersion = 1;
+
+	std::int16_t quantize(float v)
+	{
+		return static_cast<std::int16_t>(std::lround(std::clamp(v * kPosScale, -32767.0f, 32767.0f)));
+	}
+
+	float dequantize(std::int16_t v) { return v / kPosScale; }
+
+	/// Índice fracionário na grade, limitado a [0, n − 1].
+	float gridCoord(float v, float mn, float step, int n)
+	{
+		return std::clamp((v - mn) / step, 0.0f, static_cast<float>(n - 1));
+	}
+}
+
+std::size_t AimTable::entryIndex(int shooter, int launch, int angle, int power)
+{
+	return ((static_cast<std::size_t>(shooter - 1) * kLaunches + launch) * kAngles + angle) * kPowers + power;
+}
+
+std::size_t AimTable::aimIndex(int shooter, int launch, int target)
+{
+	return (static_cast<std::size_t>(shooter - 1) * kLaunches + launch) * kTargets + target;
+}
+
+std::size_t AimTable::bytes() const
+{
+	return entries.size() * sizeof(Entry) + aims.size() * sizeof(std::uint16_t);
+}
+
+// ╔═══════════════════════════════════════════════════════════════════════════╗
+// ║                              Construção                                   ║
+// ╚═══════════════════════════════════════════════════════════════════════════╝
+
+void AimTable::build(const GameState &s)
+{
+	skyline = skylineHash(s);
+	entries.assign(entryIndex(3, 0, 0, 0), Entry{});
+	aims.assign(aimIndex(3, 0, 0), kNoAim);
+	std::vector<float> bestError(aims.size(), kTargetTolerance);
+
+	for (int shooter = 1; shooter <= 2; ++shooter)
+	{
+		const float dir = (shooter == 1) ? +1.0f : -1.0f;
+		for (int l = 0; l < kLaunches; ++l)
+		{
+			const glm::vec2 start(kLaunchMin[shooter - 1] + l * kLaunchStep, kLaunchY);
+			for (int a = 0; a < kAngles; ++a)
+				for (int p = 0; p < kPowers; ++p)
+				{
+					// Mesmas equações do jogo, só contra prédios e arena.
+					const Trajectory tr = makeTrajectory(start, a * kAngleStep, kPowerMin + p * kPowerStep, dir, s.gravity);
+					const float tExit = arenaExitTime(tr);
+					const float tBuilding = s.grid.firstHit(tr, tExit);
+					const ShotOutcome o = firstImpact(tBuilding, -1, kNoHit, tExit);
+					const glm::vec2 hit = tr.at(o.time);
+
+					Entry &e = entries[entryIndex(shooter, l, a, p)];
+					e.x = quantize(hit.x);
+					e.y = quantize(hit.y);
+					e.event = static_cast<std::uint8_t>(o.event);
+					e.crossX = kNoCross;
+
+					// Descida pela altura do alvo: segunda raiz de y(t) = kTargetY.
+					const float disc = tr.velocity.y * tr.velocity.y + 2.0f * tr.gravity * (tr.start.y - kTargetY);
+					if (tr.gravity <= 0.0f || disc < 0.0f)
+						continue;
+					const float tCross = (tr.velocity.y + std::sqrt(disc)) / tr.gravity;
+					if (tCross > o.time)
+						continue; // bateu antes num prédio ou saiu da arena
+					const float cx = tr.at(tCross).x;
+					e.crossX = quantize(cx);
+
+					// Tabela inversa: guarda a amostra mais próxima de cada alvo.
+					const int t = static_cast<int>(std::lround((cx - kArenaMinX) / kTargetStep));
+					if (t < 0 || t >= kTargets)
+						continue;
+					const float err = std::abs(cx - (kArenaMinX + t * kTargetStep));
+					const std::size_t ai = aimIndex(shooter, l, t);
+					if (err < bestError[ai])
+					{
+						bestError[ai] = err;
+						aims[ai] = static_cast<std::uint16_t>(a * kPowers + p);
+					}
+				}
+		}
+	}
+}
+
+// ╔═══════════════════════════════════════════════════════════════════════════╗
+// ║                               Consultas                                   ║
+// ╚═══════════════════════════════════════════════════════════════════════════╝
+
+AimTable::Landing AimTable::landing(int shooter, float launchX, float angleDeg, float power) const
+{
+	const float fl = gridCoord(launchX, kLaunchMin[shooter - 1], kLaunchStep, kLaunches);
+	const float fa = gridCoord(angleDeg, 0.0f, kAngleStep, kAngles);
+	const float fp = gridCoord(power, kPowerMin, kPowerStep, kPowers);
+	const int l0 = std::min(static_cast<int>(fl), kLaunches - 2);
+	const int a0 = std::min(static_cast<int>(fa), kAngles - 2);
+	const int p0 = std::min(static_cast<int>(fp), kPowers - 2);
+	const float wl = fl - l0, wa = fa - a0, wp = fp - p0;
+
+	// O evento vem da amostra mais próxima; o ponto é interpolado só entre
+	// cantos com o mesmo evento (misturar prédio e saída não faz sentido).
+	const Entry &nearest = entries[entryIndex(shooter, l0 + (wl > 0.5f), a0 + (wa > 0.5f), p0 + (wp > 0.5f))];
+	glm::vec2 sum(0.0f);
+	float weight = 0.0f;
+	for (int corner = 0; corner < 8; ++corner)
+	{
+		const int dl = corner & 1, da = (corner >> 1) & 1, dp = (corner >> 2) & 1;
+		const Entry &e = entries[entryIndex(shooter, l0 + dl, a0 + da, p0 + dp)];
+		if (e.event != nearest.event)
+			continue;
+		const float w = (dl ? wl : 1.0f - wl) * (da ? wa : 1.0f - wa) * (dp ? wp : 1.0f - wp);
+		sum += w * glm::vec2(dequantize(e.x), dequantize(e.y));
+		weight += w;
+	}
+
+	Landing out;
+	out.event = static_cast<StepEvent>(nearest.event);
+	out.point = (weight > 0.0f) ? sum / weight : glm::vec2(dequantize(nearest.x), dequantize(nearest.y));
+	return out;
+}
+
+AimTable::Aim AimTable::aimFor(int shooter, float launchX, float targetX) const
+{
+	const int l = static_cast<int>(std::lround(gridCoord(launchX, kLaunchMin[shooter - 1], kLaunchStep, kLaunches)));
+	const int t = static_cast<int>(std::lround(gridCoord(targetX, kArenaMinX, kTargetStep, kTargets)));
+
+	Aim out;
+	const std::uint16_t packed = aims[aimIndex(shooter, l, t)];
+	if (packed == kNoAim)
+		return out;
+	out.valid = true;
+	out.angleDeg = (packed / kPowers) * kAngleStep;
+	out.power = kPowerMin + (packed % kPowers) * kPowerStep;
+	return out;
+}
+
+// ╔═══════════════════════════════════════════════════════════════════════════╗
+// ║                             Serialização                                  ║
+// ╚═══════════════════════════════════════════════════════════════════════════╝
+
+/* Formato (little‑endian, como nas plataformas suportadas):
+	 "GAIM" | versão u32 | skyline u64 | nEntries u32 | nAims u32 | entries | aims */
+
+std::uint64_t AimTable::skylineHash(const GameState &s)
+{
+	// FNV‑1a 64 bits sobre os bytes dos prédios e da gravidade.
+	std::uint64_t h = 1469598103934665603ull;
+	auto mix = [&](const void *data, std::size_t n)
+	{
+		const unsigned char *p = static_cast<const unsigned char *>(data);
+		for (std::size_t i = 0; i < n; ++i)
+			h = (h ^ p[i]) * 1099511628211ull;
+	};
+	for (const Building &b : s.buildings)
+	{
+		const float v[4] = {b.pos.x, b.pos.y, b.size.x, b.size.y};
+		mix(v, sizeof(v));
+	}
+	mix(&s.gravity, sizeof(s.gravity));
+	mix(&kVersion, sizeof(kVersion));
+	return h;
+}
+
+bool AimTable::save(const std::string &path) const
+{
+	std::ofstream f(path, std::ios::binary);
+	if (!f)
+		return false;
+	const std::uint32_t nEntries = static_cast<std::uint32_t>(entries.size());
+	const std::uint32_t nAims = static_cast<std::uint32_t>(aims.size());
+	f.write(kMagic, sizeof(kMagic));
+	f.write(reinterpret_cast<const char *>(&kVersion), sizeof(kVersion));
+	f.write(reinterpret_cast<const char *>(&skyline), sizeof(skyline));
+	f.write(reinterpret_cast<const char *>(&nEntries), sizeof(nEntries));
+	f.write(reinterpret_cast<const char *>(&nAims), sizeof(nAims));
+	f.write(reinterpret_cast<const char *>(entries.data()), nEntries * sizeof(Entry));
+	f.write(reinterpret_cast<const char *>(aims.data()), nAims * sizeof(std::uint16_t));
+	return static_cast<bool>(f);
+}
+
+bool AimTable::load(const std::string &path, std::uint64_t expectedSkyline)
+{
+	std::ifstream f(path, std::ios::binary);
+	if (!f)
+		return false;
+
+	char magic[4];
+	std::uint32_t version = 0, nEntries = 0, nAims = 0;
+	std::uint64_t hash = 0;
+	f.read(magic, sizeof(magic));
+	f.read(reinterpret_cast<char *>(&version), sizeof(version));
+	f.read(reinterpret_cast<char *>(&hash), sizeof(hash));
+	f.read(reinterpret_cast<char *>(&nEntries), sizeof(nEntries));
+	f.read(reinterpret_cast<char *>(&nAims), sizeof(nAims));
+	if (!f || std::memcmp(magic, kMagic, sizeof(magic)) != 0 || version != kVersion ||
+			hash != expectedSkyline || nEntries != entryIndex(3, 0, 0, 0) || nAims != aimIndex(3, 0, 0))
+		return false;
+
+	std::vector<Entry> e(nEntries);
+	std::vector<std::uint16_t> a(nAims);
+	f.read(reinterpret_cast<char *>(e.data()), nEntries * sizeof(Entry));
+	f.read(reinterpret_cast<char *>(a.data()), nAims * sizeof(std::uint16_t));
+	if (!f)
+		return false;
+
+	skyline = hash;
+	entries = std::move(e);
+	aims = std::move(a);
+	return true;
+}
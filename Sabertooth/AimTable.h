@@ -0,0 +1,83 @@
+#pragma once
+/*
+------------------------------------------------------------------------------
+ AimTable.h  –  Tabela balística pré‑calculada por cenário
+------------------------------------------------------------------------------
+ Para um horizonte fixo de prédios, o mapeamento (posição de lançamento,
+ ângulo, força) → impacto não muda. A tabela amostra esse espaço numa grade
+ quantizada uma única vez por fase (initGame) e responde em tempo constante:
+
+	 • landing(): onde um disparo cai (interpolação trilinear entre amostras);
+	 • aimFor():  que ângulo/força leva o projétil até o alvo na coordenada X.
+
+ Os jogadores não entram na tabela (eles se movem); para o alvo guardamos o
+ ponto em que a trajetória desce pela altura do centro dos jogadores sem ter
+ batido antes num prédio. Cada amostra ocupa 8 bytes (coordenadas em int16) e
+ a tabela pode ser gravada em arquivo e distribuída junto com a fase.
+------------------------------------------------------------------------------*/
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+struct GameState;
+enum class StepEvent;
+
+class AimTable
+{
+public:
+	/// Resultado de landing(): ponto e tipo do primeiro contato com o cenário.
+	struct Landing
+	{
+		glm::vec2 point{0.0f};
+		StepEvent event{}; ///< HitBuilding ou OffMap (zero = StepEvent::None)
+	};
+
+	/// Resultado de aimFor().
+	struct Aim
+	{
+		bool valid = false; ///< false se nenhuma amostra alcança o alvo
+		float angleDeg = 0.0f;
+		float power = 0.0f;
+	};
+
+	/// Amostra todos os lançamentos possíveis no cenário de s.
+	void build(const GameState &s);
+
+	/// Onde cai o disparo de `shooter` (1 ou 2) lançado de launchX.
+	[[nodiscard]] Landing landing(int shooter, float launchX, float angleDeg, float power) const;
+
+	/// Ângulo/força para que o disparo de `shooter`, lançado de launchX, passe
+	/// pela altura dos jogadores em targetX.
+	[[nodiscard]] Aim aimFor(int shooter, float launchX, float targetX) const;
+
+	/// Grava / lê a tabela. load() rejeita arquivos de outra versão ou de
+	/// outro cenário (skylineHash diferente).
+	bool save(const std::string &path) const;
+	bool load(const std::string &path, std::uint64_t expectedSkyline);
+
+	/// Impressão digital do cenário (prédios e gravidade) usada em load().
+	static std::uint64_t skylineHash(const GameState &s);
+
+	[[nodiscard]] bool empty() const { return entries.empty(); }
+	[[nodiscard]] std::size_t bytes() const;
+
+private:
+	/// Uma amostra: impacto quantizado e cruzamento com a altura do alvo.
+	struct Entry
+	{
+		std::int16_t x, y;		 ///< ponto de impacto (×kPosScale)
+		std::int16_t crossX;	 ///< X na altura do alvo (kNoCross se não chega)
+		std::uint8_t event;		 ///< StepEvent do impacto
+		std::uint8_t reserved; ///< alinhamento
+	};
+
+	std::uint64_t skyline = 0;
+	std::vector<Entry> entries; ///< [shooter][launch][angle][power]
+	std::vector<std::uint16_t> aims; ///< [shooter][launch][targetX] → ângulo·P + força
+
+	static std::size_t entryIndex(int shooter, int launch, int angle, int power);
+	static std::size_t aimIndex(int shooter, int launch, int target);
+};
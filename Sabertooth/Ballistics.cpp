@@ -0,0 +1,142 @@
+#include "Ballistics.h"
+#include <algorithm>
+#include <cmath>
+/*
+------------------------------------------------------------------------------
+ Ballistics.cpp  –  Implementação da interseção parábola × caixa
+------------------------------------------------------------------------------
+ As contas internas usam double: as raízes das quadráticas são subtrações de
+ números próximos e o custo extra é irrelevante (uma vez por disparo).
+------------------------------------------------------------------------------*/
+
+// ╔═══════════════════════════════════════════════════════════════════════════╗
+// ║                             Funções Auxiliares                            ║
+// ╚═══════════════════════════════════════════════════════════════════════════╝
+
+namespace
+{
+	constexpr double INF = std::numeric_limits<double>::infinity();
+
+	/// Intervalo fechado [lo, hi]; vazio quando lo > hi.
+	struct Interval
+	{
+		double lo, hi;
+	};
+
+	/// Tempos em que p0 + v·t fica dentro de [mn, mx].
+	Interval linearInside(double p0, double v, double mn, double mx)
+	{
+		if (v == 0.0)
+			return (p0 < mn || p0 > mx) ? Interval{INF, -INF} : Interval{-INF, INF};
+		double a = (mn - p0) / v;
+		double b = (mx - p0) / v;
+		if (a > b)
+			std::swap(a, b);
+		return {a, b};
+	}
+
+	/// Raízes de y(t) = level, com y(t) = y0 + vy·t − ½·g·t² e g > 0.
+	/// Retorna false se a parábola nunca alcança o nível.
+	bool parabolaRoots(double y0, double vy, double g, double level,
+										 double &r0, double &r1)
+	{
+		const double disc = vy * vy + 2.0 * g * (y0 - level);
+		if (disc < 0.0)
+			return false;
+		const double sq = std::sqrt(disc);
+		r0 = (vy - sq) / g;
+		r1 = (vy + sq) / g;
+		return true;
+	}
+}
+
+// ╔═══════════════════════════════════════════════════════════════════════════╗
+// ║                          Implementação das Funções                        ║
+// ╚═══════════════════════════════════════════════════════════════════════════╝
+
+Trajectory makeTrajectory(const glm::vec2 &start, float angleDeg, float power,
+													float dir, float gravity)
+{
+	const float rad = glm::radians(angleDeg);
+	Trajectory tr;
+	tr.start = start;
+	tr.velocity = {dir * power * std::cos(rad), power * std::sin(rad)};
+	tr.gravity = gravity;
+	return tr;
+}
+
+float sweepAABB(const Trajectory &tr, const glm::vec2 &boxMin,
+								const glm::vec2 &boxMax, float half)
+{
+	// Soma de Minkowski: testamos o **centro** do projétil contra a caixa
+	// expandida pela meia‑largura dele.
+	const double minX = double(boxMin.x) - half, maxX = double(boxMax.x) + half;
+	const double minY = double(boxMin.y) - half, maxY = double(boxMax.y) + half;
+
+	// 1. Janela de tempo em X (movimento uniforme), restrita a t ≥ 0.
+	Interval ix = linearInside(tr.start.x, tr.velocity.x, minX, maxX);
+	ix.lo = std::max(ix.lo, 0.0);
+	if (ix.lo > ix.hi)
+		return kNoHit;
+
+	const double y0 = tr.start.y, vy = tr.velocity.y, g = tr.gravity;
+	if (g == 0.0)
+	{
+		const Interval iy = linearInside(y0, vy, minY, maxY);
+		const double lo = std::max(ix.lo, iy.lo);
+		return (lo <= std::min(ix.hi, iy.hi)) ? float(lo) : kNoHit;
+	}
+
+	// 2. Em Y a parábola é côncava: y ≥ minY vale num único intervalo [a, b];
+	//    y ≤ maxY vale fora do intervalo aberto (c, d) em que ela passa do topo.
+	double a, b;
+	if (!parabolaRoots(y0, vy, g, minY, a, b))
+		return kNoHit; // nunca alcança a base da caixa
+
+	double c, d;
+	if (!parabolaRoots(y0, vy, g, maxY, c, d))
+	{
+		c = INF; // nunca passa do topo: y ≤ maxY sempre
+		d = INF;
+	}
+
+	// Y = [a, min(b, c)] ∪ [max(a, d), b]; o primeiro trecho viável vence.
+	const Interval candidates[2] = {{a, std::min(b, c)}, {std::max(a, d), b}};
+	for (const Interval &iy : candidates)
+	{
+		const double lo = std::max(ix.lo, iy.lo);
+		const double hi = std::min(ix.hi, iy.hi);
+		if (lo <= hi)
+			return float(lo);
+	}
+	return kNoHit;
+}
+
+float arenaExitTime(const Trajectory &tr)
+{
+	double t = INF;
+
+	// Saída lateral
+	const double vx = tr.velocity.x;
+	if (vx > 0.0)
+		t = (kArenaMaxX - tr.start.x) / vx;
+	else if (vx < 0.0)
+		t = (kArenaMinX - tr.start.x) / vx;
+
+	const double y0 = tr.start.y, vy = tr.velocity.y, g = tr.gravity;
+	if (g > 0.0)
+	{
+		double r0, r1;
+		// Queda abaixo do piso: segunda raiz de y(t) = minY.
+		if (parabolaRoots(y0, vy, g, kArenaMinY, r0, r1))
+			t = std::min(t, r1);
+		// Passagem pelo teto: primeira raiz de y(t) = maxY, se existir.
+		if (parabolaRoots(y0, vy, g, kArenaMaxY, r0, r1) && r0 >= 0.0)
+			t = std::min(t, r0);
+	}
+	else if (vy != 0.0)
+	{
+		t = std::min(t, ((vy > 0.0 ? kArenaMaxY : kArenaMinY) - y0) / vy);
+	}
+	return float(std::max(t, 0.0));
+}
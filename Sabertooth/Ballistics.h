@@ -0,0 +1,63 @@
+#pragma once
+/*
+------------------------------------------------------------------------------
+ Ballistics.h  –  Trajetória parabólica e interseção analítica com caixas
+------------------------------------------------------------------------------
+ Em vez de amostrar a posição do projétil a cada passo e testar sobreposição
+ (o que deixa passar obstáculos finos quando a força é alta), resolvemos as
+ equações de movimento em forma fechada:
+
+		 x(t) = x0 + vx·t
+		 y(t) = y0 + vy·t − ½·g·t²
+
+ contra cada caixa (já expandida pela meia‑caixa do projétil). O resultado é
+ o instante **exato** do primeiro contato, calculado uma única vez no disparo.
+------------------------------------------------------------------------------*/
+
+#include <glm/glm.hpp>
+#include <limits>
+
+/// Valor devolvido quando a trajetória nunca toca a caixa.
+constexpr float kNoHit = std::numeric_limits<float>::infinity();
+
+/// Limites da arena: fora deles o projétil é descartado.
+constexpr float kArenaMinX = -12.0f;
+constexpr float kArenaMaxX = 12.0f;
+constexpr float kArenaMinY = -5.0f;
+constexpr float kArenaMaxY = 15.0f;
+
+/// Meia‑largura da caixa que envolve o projétil (esfera ≈ caixa 0.4×0.4).
+constexpr float kProjectileHalf = 0.2f;
+
+/// Parâmetros de um lançamento, congelados no instante do disparo.
+struct Trajectory
+{
+	glm::vec2 start{0.0f};		///< posição no instante do disparo
+	glm::vec2 velocity{0.0f}; ///< velocidade inicial (vx já com o sentido)
+	float gravity = 9.8f;			///< aceleração para baixo
+
+	/// Posição em t segundos de voo.
+	[[nodiscard]] glm::vec2 at(float t) const
+	{
+		return {start.x + velocity.x * t,
+						start.y + velocity.y * t - 0.5f * gravity * t * t};
+	}
+};
+
+/// Monta a trajetória a partir de ângulo (graus), força e sentido (+1 / −1).
+Trajectory makeTrajectory(const glm::vec2 &start, float angleDeg, float power,
+													float dir, float gravity);
+
+/**
+ * @brief Primeiro instante t ≥ 0 em que a caixa do projétil toca a caixa
+ *        [boxMin, boxMax]. Contato nas bordas conta como colisão, igual a
+ *        checkCollisionBB.
+ * @param half  meia‑largura da caixa do projétil
+ * @return      tempo de voo do impacto ou kNoHit
+ */
+float sweepAABB(const Trajectory &tr, const glm::vec2 &boxMin,
+								const glm::vec2 &boxMax, float half);
+
+/// Instante em que o centro do projétil deixa a arena (sempre finito se g > 0
+/// ou se houver velocidade).
+float arenaExitTime(const Trajectory &tr);
@@ -0,0 +1,378 @@
+/*
+------------------------------------------------------------------------------
+ Benchmark.cpp  –  Micro-benchmarks sem janela nem GPU (física e geometria)
+------------------------------------------------------------------------------
+ Uso:  Benchmark [--json saida.json] [--filter texto] [--samples N]
+                 [--min-ms M] [--data pasta]
+
+ Mede, só com a GorillaCore e o stb_image:
+	 • checkCollisionBB em pares de caixas aleatórias;
+	 • voos completos com step() (disparo → impacto), por passo de física;
+	 • generateSphereVertices / generateIndexedSphere em várias resoluções;
+	 • decodificação das texturas do jogo com stb_image (da memória, sem E/S).
+
+ Cada caso é aquecido (warmup) e calibrado para que uma amostra dure pelo
+ menos --min-ms; depois são tiradas --samples amostras independentes. O
+ resultado traz mediana, média com intervalo de 95 %, desvio padrão, MAD e
+ mínimo, em nanossegundos por operação. Com --json, o mesmo vai para um
+ arquivo que a integração contínua pode comparar entre commits – a mediana
+ é a medida mais estável para isso.
+------------------------------------------------------------------------------*/
+
+#define STB_IMAGE_IMPLEMENTATION
+#include "stb_image.h"
+
+#include "Game.h"
+#include "Geometry.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <iterator>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+// ╔═══════════════════════════════════════════════════════════════════════════╗
+// ║                                Medição                                    ║
+// ╚═══════════════════════════════════════════════════════════════════════════╝
+
+struct Options
+{
+	int samples = 30;					 ///< amostras por caso
+	double minSampleMs = 20.0; ///< duração mínima de uma amostra
+	double warmupMs = 200.0;	 ///< aquecimento antes da calibração
+	std::string filter;				 ///< só casos cujo nome contém o texto
+	std::string json;					 ///< arquivo de saída (vazio = só a tabela)
+	std::string dataDir = "."; ///< onde estão as texturas
+};
+
+struct Result
+{
+	std::string name;
+	std::string unit;							 ///< o que é uma "operação"
+	std::uint64_t opsPerSample = 0;
+	double min = 0, median = 0, mean = 0, stddev = 0, ci95 = 0, mad = 0; ///< ns/op
+};
+
+using Clock = std::chrono::steady_clock;
+
+/// Impede o compilador de descartar um resultado que ninguém lê.
+template <class T>
+static inline void keep(const T &value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+	asm volatile("" : : "g"(&value) : "memory");
+#else
+	const volatile char *p = reinterpret_cast<const volatile char *>(&value);
+	(void)*p;
+	_ReadWriteBarrier();
+#endif
+}
+
+/// Mediana de um vetor já ordenado.
+static double medianOf(const std::vector<double> &v)
+{
+	const size_t n = v.size();
+	return (n % 2) ? v[n / 2] : 0.5 * (v[n / 2 - 1] + v[n / 2]);
+}
+
+/// Roda `body(iters)` (que devolve quantas operações fez) com aquecimento,
+/// calibração e `o.samples` amostras e acrescenta as estatísticas (ns/op) a
+/// `out`. Casos fora de --filter não rodam.
+template <class Body>
+static void measure(std::vector<Result> &out, const std::string &name, const char *unit,
+										const Options &o, Body &&body)
+{
+	if (!o.filter.empty() && name.find(o.filter) == std::string::npos)
+		return;
+
+	auto timed = [&](std::uint64_t iters, std::uint64_t &ops)
+	{
+		const auto t0 = Clock::now();
+		ops = body(iters);
+		return std::chrono::duration<double, std::nano>(Clock::now() - t0).count();
+	};
+
+	// Aquecimento: caches, preditor de desvios e frequência da CPU estáveis.
+	std::uint64_t iters = 1, ops = 0;
+	for (double spent = 0.0; spent < o.warmupMs * 1e6;)
+		spent += timed(iters, ops);
+
+	// Calibração: dobra até uma amostra durar --min-ms.
+	for (;;)
+	{
+		const double ns = timed(iters, ops);
+		if (ns >= o.minSampleMs * 1e6 || iters >= (1ull << 40))
+			break;
+		iters *= 2;
+	}
+
+	std::vector<double> perOp;
+	perOp.reserve(o.samples);
+	for (int i = 0; i < o.samples; ++i)
+	{
+		const double ns = timed(iters, ops);
+		perOp.push_back(ns / static_cast<double>(ops ? ops : 1));
+	}
+
+	Result r;
+	r.name = name;
+	r.unit = unit;
+	r.opsPerSample = ops;
+
+	std::sort(perOp.begin(), perOp.end());
+	const double n = static_cast<double>(perOp.size());
+	double sum = 0.0;
+	for (double v : perOp)
+		sum += v;
+	r.mean = sum / n;
+	double sq = 0.0;
+	for (double v : perOp)
+		sq += (v - r.mean) * (v - r.mean);
+	r.stddev = (n > 1) ? std::sqrt(sq / (n - 1)) : 0.0;
+	r.ci95 = 1.96 * r.stddev / std::sqrt(n); // aproximação normal (n ≥ 30)
+	r.min = perOp.front();
+	r.median = medianOf(perOp);
+
+	std::vector<double> dev;
+	for (double v : perOp)
+		dev.push_back(std::fabs(v - r.median));
+	std::sort(dev.begin(), dev.end());
+	r.mad = medianOf(dev);
+	out.push_back(std::move(r));
+}
+
+// ╔═══════════════════════════════════════════════════════════════════════════╗
+// ║                                 Casos                                     ║
+// ╚═══════════════════════════════════════════════════════════════════════════╝
+
+static void benchCollision(const Options &o, std::vector<Result> &out)
+{
+	struct Pair
+	{
+		glm::vec2 c1, s1, c2, s2;
+	};
+	std::mt19937 rng(1234);
+	std::uniform_real_distribution<float> pos(-10.0f, 10.0f), size(0.2f, 4.0f);
+	std::vector<Pair> pairs(1024);
+	for (Pair &p : pairs)
+		p = {{pos(rng), pos(rng)}, {size(rng), size(rng)}, {pos(rng), pos(rng)}, {size(rng), size(rng)}};
+
+	measure(out, "checkCollisionBB", "chamada", o, [&](std::uint64_t iters)
+												{
+		int hits = 0;
+		for (std::uint64_t i = 0; i < iters; ++i)
+		{
+			const Pair &p = pairs[i & 1023];
+			hits += checkCollisionBB(p.c1, p.s1, p.c2, p.s2);
+		}
+		keep(hits);
+		return iters; });
+}
+
+/// Um voo inteiro: dispara e avança passos fixos até o impacto.
+static std::uint64_t fly(GameState &s, int player, float angle, float power, float dt)
+{
+	s.currentPlayer = player;
+	s.angleDeg = angle;
+	s.power = power;
+	s.showExplosion = false;
+	resetProjectile(s);
+
+	Input fire;
+	fire.fire = true;
+	std::uint64_t steps = 1;
+	StepEvent ev = step(s, fire, dt);
+	while (ev == StepEvent::None || ev == StepEvent::Fired)
+	{
+		ev = step(s, Input{}, dt);
+		++steps;
+	}
+	return steps;
+}
+
+static void benchFlights(const Options &o, std::vector<Result> &out)
+{
+	GameState base;
+	initGame(base); // tabela balística montada aqui, fora da medição
+
+	struct Shot
+	{
+		int player;
+		float angle, power;
+	};
+	std::vector<Shot> shots;
+	for (int player = 1; player <= 2; ++player)
+		for (float angle = 20.0f; angle <= 70.0f; angle += 5.0f)
+			for (float power : {6.0f, 10.0f, 14.0f})
+				shots.push_back({player, angle, power});
+
+	const float dt = 1.0f / 120.0f; // PHYSICS_HZ do jogo
+	GameState s = base;
+	measure(out, "step/voo completo", "passo", o, [&](std::uint64_t iters)
+												{
+		std::uint64_t steps = 0;
+		for (std::uint64_t i = 0; i < iters; ++i)
+		{
+			const Shot &sh = shots[i % shots.size()];
+			steps += fly(s, sh.player, sh.angle, sh.power, dt);
+		}
+		keep(s.projectileX);
+		return steps; });
+}
+
+static void benchSpheres(const Options &o, std::vector<Result> &out)
+{
+	for (int n : {8, 16, 32, 64})
+	{
+		const std::string res = std::to_string(n) + "x" + std::to_string(n);
+		measure(out, "generateSphereVertices/" + res, "esfera", o, [&](std::uint64_t iters)
+													{
+			for (std::uint64_t i = 0; i < iters; ++i)
+			{
+				std::vector<float> v = generateSphereVertices(0.2f, n, n);
+				keep(v.data());
+			}
+			return iters; });
+		measure(out, "generateIndexedSphere/" + res, "esfera", o, [&](std::uint64_t iters)
+													{
+			for (std::uint64_t i = 0; i < iters; ++i)
+			{
+				IndexedMesh m = generateIndexedSphere(0.2f, n, n);
+				keep(m.indices.data());
+			}
+			return iters; });
+	}
+}
+
+static void benchDecode(const Options &o, std::vector<Result> &out)
+{
+	stbi_set_flip_vertically_on_load(1); // como o TextureLoader
+
+	for (const char *file : {"city_bg.jpg", "building_texture_2.jpg", "player1_texture.png"})
+	{
+		const std::string path = o.dataDir + "/" + file;
+		std::ifstream in(path, std::ios::binary);
+		if (!in)
+		{
+			std::cerr << "[Benchmark] " << path << " não encontrado; caso ignorado\n";
+			continue;
+		}
+		const std::vector<unsigned char> bytes((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+
+		measure(out, std::string("stbi_load/") + file, "imagem", o, [&](std::uint64_t iters)
+													{
+			for (std::uint64_t i = 0; i < iters; ++i)
+			{
+				int w, h, c;
+				unsigned char *px = stbi_load_from_memory(bytes.data(), static_cast<int>(bytes.size()), &w, &h, &c, 4);
+				keep(px);
+				stbi_image_free(px);
+			}
+			return iters; });
+	}
+}
+
+// ╔═══════════════════════════════════════════════════════════════════════════╗
+// ║                                 Saída                                     ║
+// ╚═══════════════════════════════════════════════════════════════════════════╝
+
+static void printTable(const std::vector<Result> &results)
+{
+	std::cout << std::left << std::setw(36) << "caso" << std::right << std::setw(14) << "mediana"
+						<< std::setw(22) << "média ± IC95" << std::setw(10) << "desvio" << std::setw(14) << "mínimo"
+						<< "  (ns por operação)\n";
+	std::cout << std::fixed << std::setprecision(1);
+	for (const Result &r : results)
+	{
+		std::ostringstream mean;
+		mean << std::fixed << std::setprecision(1) << r.mean << " ± " << r.ci95;
+		std::cout << std::left << std::setw(36) << r.name << std::right << std::setw(14) << r.median
+							<< std::setw(22) << mean.str() << std::setw(9) << (r.mean > 0 ? 100.0 * r.stddev / r.mean : 0.0) << '%'
+							<< std::setw(14) << r.min << "  /" << r.unit << '\n';
+	}
+}
+
+static bool writeJson(const std::string &path, const Options &o, const std::vector<Result> &results)
+{
+	std::ofstream out(path, std::ios::binary);
+	if (!out)
+		return false;
+
+#ifdef NDEBUG
+	const char *build = "release";
+#else
+	const char *build = "debug";
+#endif
+	out << std::setprecision(6) << "{\n  \"version\": 1,\n  \"build\": \"" << build
+			<< "\",\n  \"samples\": " << o.samples << ",\n  \"unit\": \"ns/op\",\n  \"results\": [";
+	for (size_t i = 0; i < results.size(); ++i)
+	{
+		const Result &r = results[i];
+		out << (i ? ",\n" : "\n") << "    {\"name\": \"" << r.name << "\", \"op\": \"" << r.unit
+				<< "\", \"opsPerSample\": " << r.opsPerSample << ", \"median\": " << r.median
+				<< ", \"mean\": " << r.mean << ", \"ci95\": " << r.ci95 << ", \"stddev\": " << r.stddev
+				<< ", \"mad\": " << r.mad << ", \"min\": " << r.min << '}';
+	}
+	out << "\n  ]\n}\n";
+	return static_cast<bool>(out);
+}
+
+// ╔═══════════════════════════════════════════════════════════════════════════╗
+// ║                                   main                                    ║
+// ╚═══════════════════════════════════════════════════════════════════════════╝
+int main(int argc, char **argv)
+{
+	Options o;
+	for (int i = 1; i < argc; ++i)
+	{
+		const std::string a = argv[i];
+		const bool hasValue = i + 1 < argc;
+		if (a == "--json" && hasValue)
+			o.json = argv[++i];
+		else if (a == "--filter" && hasValue)
+			o.filter = argv[++i];
+		else if (a == "--samples" && hasValue)
+			o.samples = std::max(2, std::atoi(argv[++i]));
+		else if (a == "--min-ms" && hasValue)
+			o.minSampleMs = std::atof(argv[++i]);
+		else if (a == "--data" && hasValue)
+			o.dataDir = argv[++i];
+		else
+		{
+			std::cerr << "Uso: Benchmark [--json saida.json] [--filter texto] [--samples N]"
+									 " [--min-ms M] [--data pasta]\n";
+			return 1;
+		}
+	}
+
+	std::vector<Result> results;
+	benchCollision(o, results);
+	benchFlights(o, results);
+	benchSpheres(o, results);
+	benchDecode(o, results);
+
+	printTable(results);
+	if (!o.json.empty())
+	{
+		if (!writeJson(o.json, o, results))
+		{
+			std::cerr << "[Benchmark] Não foi possível gravar " << o.json << "\n";
+			return 1;
+		}
+		std::cout << "Resultados gravados em " << o.json << "\n";
+	}
+	return 0;
+}
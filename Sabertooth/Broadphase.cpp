@@ -0,0 +1,142 @@
+#include "Broadphase.h"
+#include "Game.h"
+#include <algorithm>
+#include <cmath>
+/*
+------------------------------------------------------------------------------
+ Broadphase.cpp  –  Implementação da grade uniforme
+------------------------------------------------------------------------------*/
+
+BuildingGrid::BuildingGrid(float cellSize) : cell(cellSize)
+{
+	cols = static_cast<int>(std::ceil((kArenaMaxX - kArenaMinX) / cell));
+	rows = static_cast<int>(std::ceil((kArenaMaxY - kArenaMinY) / cell));
+	cellStart.assign(static_cast<std::size_t>(cols) * rows + 1, 0);
+}
+
+int BuildingGrid::columnOf(float x) const
+{
+	const int c = static_cast<int>(std::floor((x - kArenaMinX) / cell));
+	return std::clamp(c, 0, cols - 1);
+}
+
+int BuildingGrid::rowOf(float y) const
+{
+	const int r = static_cast<int>(std::floor((y - kArenaMinY) / cell));
+	return std::clamp(r, 0, rows - 1);
+}
+
+void BuildingGrid::build(const std::vector<Building> &buildings)
+{
+	count = buildings.size();
+
+	// Primeiro agrupa os índices por célula; depois copia as caixas para o
+	// SoA na ordem das células, completando cada uma até o bloco SIMD.
+	const std::size_t nCells = static_cast<std::size_t>(cols) * rows;
+	std::vector<std::vector<std::uint32_t>> perCell(nCells);
+	for (std::size_t i = 0; i < buildings.size(); ++i)
+	{
+		// Expande pela meia‑caixa do projétil: o centro dele pode estar numa
+		// célula vizinha ao prédio e ainda assim tocá‑lo.
+		const Building &b = buildings[i];
+		const int c0 = columnOf(b.pos.x - kProjectileHalf), c1 = columnOf(b.pos.x + b.size.x + kProjectileHalf);
+		const int r0 = rowOf(b.pos.y - kProjectileHalf), r1 = rowOf(b.pos.y + b.size.y + kProjectileHalf);
+		for (int r = r0; r <= r1; ++r)
+			for (int c = c0; c <= c1; ++c)
+				perCell[static_cast<std::size_t>(r) * cols + c].push_back(static_cast<std::uint32_t>(i));
+	}
+
+	cells.clear();
+	cellStart.assign(nCells + 1, 0);
+	for (std::size_t c = 0; c < nCells; ++c)
+	{
+		for (std::uint32_t i : perCell[c])
+			cells.push(buildings[i].pos, buildings[i].pos + buildings[i].size, i);
+		cells.pad();
+		cellStart[c + 1] = static_cast<std::uint32_t>(cells.size());
+	}
+}
+
+float BuildingGrid::firstHit(const Trajectory &tr, float tMax, int *index) const
+{
+	float best = kNoHit;
+	int bestIndex = -1;
+
+	// Candidatos de um bloco de células por vez (múltiplo do bloco SIMD).
+	constexpr std::size_t kChunk = 8 * BuildingStore::kLanes;
+	std::uint32_t candidates[kChunk];
+
+	const float vx = std::abs(tr.velocity.x);
+	float t0 = 0.0f;
+	glm::vec2 p0 = tr.at(0.0f);
+
+	while (t0 < tMax)
+	{
+		// Trecho curto: deslocamento de no máximo ~uma célula por eixo.
+		const float vy = std::abs(tr.velocity.y - tr.gravity * t0);
+		const float speed = std::max(std::max(vx, vy), 1e-3f);
+		const float t1 = std::min(t0 + cell / speed, tMax);
+		const glm::vec2 p1 = tr.at(t1);
+
+		// Caixa exata do arco em [t0, t1] (expandida pelo projétil): X é
+		// monótono; Y pode ter o ápice dentro do trecho.
+		float yMin = std::min(p0.y, p1.y), yMax = std::max(p0.y, p1.y);
+		if (tr.gravity > 0.0f)
+		{
+			const float tApex = tr.velocity.y / tr.gravity;
+			if (tApex > t0 && tApex < t1)
+				yMax = std::max(yMax, tr.at(tApex).y);
+		}
+		const glm::vec2 qMin(std::min(p0.x, p1.x) - kProjectileHalf, yMin - kProjectileHalf);
+		const glm::vec2 qMax(std::max(p0.x, p1.x) + kProjectileHalf, yMax + kProjectileHalf);
+		const int c0 = columnOf(qMin.x), c1 = columnOf(qMax.x);
+		const int r0 = rowOf(qMin.y), r1 = rowOf(qMax.y);
+
+		for (int r = r0; r <= r1; ++r)
+			for (int c = c0; c <= c1; ++c)
+			{
+				const std::size_t cellIndex = static_cast<std::size_t>(r) * cols + c;
+				for (std::size_t first = cellStart[cellIndex]; first < cellStart[cellIndex + 1]; first += kChunk)
+				{
+					const std::size_t last = std::min<std::size_t>(first + kChunk, cellStart[cellIndex + 1]);
+					const std::size_t n = cells.overlaps(first, last, qMin, qMax, candidates);
+					for (std::size_t k = 0; k < n; ++k)
+					{
+						const std::size_t j = candidates[k];
+						const glm::vec2 bMin(cells.minX[j], cells.minY[j]);
+						const glm::vec2 bMax(cells.maxX[j], cells.maxY[j]);
+
+						// Um prédio aparece em várias células: testa só na primeira
+						// célula comum entre ele e o trecho atual.
+						if (std::max(columnOf(bMin.x - kProjectileHalf), c0) != c ||
+								std::max(rowOf(bMin.y - kProjectileHalf), r0) != r)
+							continue;
+
+						const int i = static_cast<int>(cells.id[j]);
+						const float t = sweepAABB(tr, bMin, bMax, kProjectileHalf);
+						if (t < best || (t == best && i < bestIndex))
+						{
+							best = t;
+							bestIndex = i;
+						}
+					}
+				}
+			}
+
+		// Qualquer prédio tocado antes de t1 cruza este trecho ou um anterior,
+		// então um impacto encontrado até aqui já é o primeiro do voo.
+		if (best <= t1)
+			break;
+		t0 = t1;
+		p0 = p1;
+	}
+
+	if (best > tMax)
+	{
+		best = kNoHit;
+		bestIndex = -1;
+	}
+	if (index)
+		*index = bestIndex;
+	return best;
+}
@@ -0,0 +1,61 @@
+#pragma once
+/*
+------------------------------------------------------------------------------
+ Broadphase.h  –  Grade uniforme de prédios para consultas de trajetória
+------------------------------------------------------------------------------
+ A arena (−12..12 × −5..15) é dividida em células quadradas; cada célula
+ guarda as caixas dos prédios que a tocam (em SoA, ver BuildingStore.h). Uma
+ consulta percorre a parábola em trechos curtos, visita só as células cobertas
+ por cada trecho, filtra as caixas delas com o teste SIMD e aplica o teste
+ exato (sweepAABB) só às que restam. Como a busca para no primeiro trecho que
+ contém um impacto, o custo depende do caminho do projétil – e não da
+ quantidade de prédios do cenário.
+------------------------------------------------------------------------------*/
+
+#include <cstdint>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include "Ballistics.h"
+#include "BuildingStore.h"
+
+struct Building;
+
+class BuildingGrid
+{
+public:
+	/// @param cellSize  lado de cada célula em unidades de mundo
+	explicit BuildingGrid(float cellSize = 1.0f);
+
+	/// (Re)constrói a grade. Deve ser chamado sempre que os prédios mudarem.
+	void build(const std::vector<Building> &buildings);
+
+	/**
+	 * @brief Primeiro prédio tocado pela trajetória em [0, tMax]. tMax deve
+	 *        ser finito – normalmente arenaExitTime(tr).
+	 * @param index  se não nulo, recebe o índice do prédio (ou −1)
+	 * @return       tempo de voo do impacto ou kNoHit
+	 */
+	float firstHit(const Trajectory &tr, float tMax, int *index = nullptr) const;
+
+	[[nodiscard]] float cellSize() const { return cell; }
+	[[nodiscard]] std::size_t size() const { return count; }
+
+private:
+	float cell;
+	int cols = 0, rows = 0;
+
+	std::size_t count = 0; ///< prédios inseridos
+
+	// Caixas agrupadas por célula em SoA: a célula c ocupa as posições
+	// [cellStart[c], cellStart[c + 1]) de cells, completadas até múltiplos de
+	// BuildingStore::kLanes para o teste SIMD. cells.id guarda o índice
+	// original do prédio (um prédio que cruza várias células se repete).
+	std::vector<std::uint32_t> cellStart;
+	BuildingStore cells;
+
+	/// Converte coordenadas de mundo em coluna/linha (limitadas à grade).
+	int columnOf(float x) const;
+	int rowOf(float y) const;
+};
@@ -0,0 +1,97 @@
+#include "BuildingStore.h"
+#include <limits>
+/*
+------------------------------------------------------------------------------
+ BuildingStore.cpp  –  Kernels de sobreposição (AVX / SSE2 / escalar)
+------------------------------------------------------------------------------*/
+
+#if defined(__AVX__)
+#include <immintrin.h>
+#define GORILLA_SIMD_AVX 1
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define GORILLA_SIMD_SSE2 1
+#endif
+
+// ╔═══════════════════════════════════════════════════════════════════════════╗
+// ║                          Construção do Armazém                            ║
+// ╚═══════════════════════════════════════════════════════════════════════════╝
+
+void BuildingStore::clear()
+{
+	minX.clear();
+	maxX.clear();
+	minY.clear();
+	maxY.clear();
+	id.clear();
+}
+
+void BuildingStore::push(const glm::vec2 &mn, const glm::vec2 &mx, std::uint32_t source)
+{
+	minX.push_back(mn.x);
+	maxX.push_back(mx.x);
+	minY.push_back(mn.y);
+	maxY.push_back(mx.y);
+	id.push_back(source);
+}
+
+void BuildingStore::pad()
+{
+	// Caixa "invertida" (min = +∞, max = −∞): toda comparação falha.
+	const float inf = std::numeric_limits<float>::infinity();
+	while (size() % kLanes != 0)
+		push({inf, inf}, {-inf, -inf}, UINT32_MAX);
+}
+
+// ╔═══════════════════════════════════════════════════════════════════════════╗
+// ║                          Teste de Sobreposição                            ║
+// ╚═══════════════════════════════════════════════════════════════════════════╝
+
+/* Mesma regra de checkCollisionBB: há sobreposição quando nenhuma condição de
+	 separação vale, ou seja  minX ≤ qMax.x, maxX ≥ qMin.x, minY ≤ qMax.y e
+	 maxY ≥ qMin.y. Cada bit da máscara corresponde a uma caixa do bloco. */
+
+std::size_t BuildingStore::overlaps(std::size_t first, std::size_t last,
+																		const glm::vec2 &qMin, const glm::vec2 &qMax,
+																		std::uint32_t *out) const
+{
+	std::size_t n = 0;
+	std::size_t i = first;
+
+	auto emit = [&](std::size_t base, unsigned mask)
+	{
+		for (std::size_t lane = 0; mask; ++lane, mask >>= 1)
+			if (mask & 1u)
+				out[n++] = static_cast<std::uint32_t>(base + lane);
+	};
+
+#if defined(GORILLA_SIMD_AVX)
+	const __m256 qx0 = _mm256_set1_ps(qMin.x), qx1 = _mm256_set1_ps(qMax.x);
+	const __m256 qy0 = _mm256_set1_ps(qMin.y), qy1 = _mm256_set1_ps(qMax.y);
+	for (; i + 8 <= last; i += 8)
+	{
+		__m256 m = _mm256_cmp_ps(_mm256_loadu_ps(&minX[i]), qx1, _CMP_LE_OQ);
+		m = _mm256_and_ps(m, _mm256_cmp_ps(_mm256_loadu_ps(&maxX[i]), qx0, _CMP_GE_OQ));
+		m = _mm256_and_ps(m, _mm256_cmp_ps(_mm256_loadu_ps(&minY[i]), qy1, _CMP_LE_OQ));
+		m = _mm256_and_ps(m, _mm256_cmp_ps(_mm256_loadu_ps(&maxY[i]), qy0, _CMP_GE_OQ));
+		emit(i, static_cast<unsigned>(_mm256_movemask_ps(m)));
+	}
+#elif defined(GORILLA_SIMD_SSE2)
+	const __m128 qx0 = _mm_set1_ps(qMin.x), qx1 = _mm_set1_ps(qMax.x);
+	const __m128 qy0 = _mm_set1_ps(qMin.y), qy1 = _mm_set1_ps(qMax.y);
+	for (; i + 4 <= last; i += 4)
+	{
+		__m128 m = _mm_cmple_ps(_mm_loadu_ps(&minX[i]), qx1);
+		m = _mm_and_ps(m, _mm_cmpge_ps(_mm_loadu_ps(&maxX[i]), qx0));
+		m = _mm_and_ps(m, _mm_cmple_ps(_mm_loadu_ps(&minY[i]), qy1));
+		m = _mm_and_ps(m, _mm_cmpge_ps(_mm_loadu_ps(&maxY[i]), qy0));
+		emit(i, static_cast<unsigned>(_mm_movemask_ps(m)));
+	}
+#endif
+
+	// Restante (ou tudo, sem SIMD): versão escalar da mesma regra.
+	for (; i < last; ++i)
+		if (minX[i] <= qMax.x && maxX[i] >= qMin.x && minY[i] <= qMax.y && maxY[i] >= qMin.y)
+			out[n++] = static_cast<std::uint32_t>(i);
+	return n;
+}
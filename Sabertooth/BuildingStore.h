@@ -0,0 +1,52 @@
+#pragma once
+/*
+------------------------------------------------------------------------------
+ BuildingStore.h  –  Caixas de prédios em estrutura de arrays (SoA) + SIMD
+------------------------------------------------------------------------------
+ Building guarda posição e tamanho (AoS) e checkCollisionBB recalcula meias
+ extensões e bordas a cada chamada. Aqui as quatro bordas de cada caixa ficam
+ pré‑calculadas em vetores separados (minX, maxX, minY, maxY), o que permite
+ comparar uma caixa de consulta com 8 prédios por instrução (AVX) ou 4 (SSE).
+ Sem suporte a SIMD, usa‑se o laço escalar equivalente.
+
+ O caminho SIMD é escolhido em tempo de compilação: AVX quando o compilador o
+ habilita (/arch:AVX2 no MSVC, -mavx2 no GCC/Clang), SSE2 em qualquer x64.
+------------------------------------------------------------------------------*/
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+class BuildingStore
+{
+public:
+	/// Largura do bloco SIMD; listas são completadas até múltiplos deste valor.
+	static constexpr std::size_t kLanes = 8;
+
+	void clear();
+
+	/// Acrescenta uma caixa [mn, mx] associada ao identificador id.
+	void push(const glm::vec2 &mn, const glm::vec2 &mx, std::uint32_t id);
+
+	/// Completa com caixas vazias (nunca colidem) até múltiplo de kLanes.
+	void pad();
+
+	[[nodiscard]] std::size_t size() const { return minX.size(); }
+
+	/**
+	 * @brief Testa a caixa [qMin, qMax] contra as posições [first, last).
+	 *        first deve ser múltiplo de kLanes e last ≤ size() (use pad()).
+	 * @param out  recebe as **posições** no store das caixas sobrepostas
+	 *             (capacidade mínima last − first)
+	 * @return     quantidade escrita em out
+	 */
+	std::size_t overlaps(std::size_t first, std::size_t last,
+											 const glm::vec2 &qMin, const glm::vec2 &qMax,
+											 std::uint32_t *out) const;
+
+	// Bordas pré‑calculadas e identificador de origem de cada caixa.
+	std::vector<float> minX, maxX, minY, maxY;
+	std::vector<std::uint32_t> id;
+};
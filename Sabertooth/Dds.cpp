@@ -0,0 +1,145 @@
+#include "Dds.h"
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <utility>
+/*
+------------------------------------------------------------------------------
+ Dds.cpp  –  Implementação do formato DDS (apenas o subconjunto DXT1/DXT5)
+------------------------------------------------------------------------------*/
+
+namespace
+{
+	constexpr std::uint32_t fourCC(char a, char b, char c, char d)
+	{
+		return std::uint32_t(std::uint8_t(a)) | std::uint32_t(std::uint8_t(b)) << 8 |
+					 std::uint32_t(std::uint8_t(c)) << 16 | std::uint32_t(std::uint8_t(d)) << 24;
+	}
+
+	// Constantes do cabeçalho (mesmos valores de SOIL2/image_DXT.h).
+	constexpr std::uint32_t kMagic = fourCC('D', 'D', 'S', ' ');
+	constexpr std::uint32_t kDXT1 = fourCC('D', 'X', 'T', '1');
+	constexpr std::uint32_t kDXT5 = fourCC('D', 'X', 'T', '5');
+	// Marca nossa em reserved1[0]; reserved1[1] guarda o raio de desfoque.
+	constexpr std::uint32_t kBlur = fourCC('G', 'B', 'L', 'R');
+	constexpr std::uint32_t DDSD_CAPS = 0x00000001;
+	constexpr std::uint32_t DDSD_HEIGHT = 0x00000002;
+	constexpr std::uint32_t DDSD_WIDTH = 0x00000004;
+	constexpr std::uint32_t DDSD_PIXELFORMAT = 0x00001000;
+	constexpr std::uint32_t DDSD_MIPMAPCOUNT = 0x00020000;
+	constexpr std::uint32_t DDSD_LINEARSIZE = 0x00080000;
+	constexpr std::uint32_t DDPF_FOURCC = 0x00000004;
+	constexpr std::uint32_t DDSCAPS_COMPLEX = 0x00000008;
+	constexpr std::uint32_t DDSCAPS_TEXTURE = 0x00001000;
+	constexpr std::uint32_t DDSCAPS_MIPMAP = 0x00400000;
+
+	/// Cabeçalho DDS (magic incluído): 32 palavras de 32 bits.
+	struct Header
+	{
+		std::uint32_t magic, size, flags, height, width, linearSize, depth, mipCount;
+		std::uint32_t reserved1[11];
+		std::uint32_t pfSize, pfFlags, pfFourCC, pfBits, pfMasks[4];
+		std::uint32_t caps1, caps2, caps3, caps4, reserved2;
+	};
+	static_assert(sizeof(Header) == 128, "cabeçalho DDS deve ter 128 bytes");
+}
+
+std::string cookedPath(const std::string &sourcePath)
+{
+	const std::size_t dot = sourcePath.find_last_of('.');
+	const std::size_t slash = sourcePath.find_last_of("/\\");
+	const bool hasExt = dot != std::string::npos && (slash == std::string::npos || dot > slash);
+	return (hasExt ? sourcePath.substr(0, dot) : sourcePath) + ".dds";
+}
+
+std::size_t ddsLevelSize(DdsFormat format, int width, int height)
+{
+	const std::size_t block = (format == DdsFormat::DXT1) ? 8 : 16;
+	return std::size_t((width + 3) / 4) * std::size_t((height + 3) / 4) * block;
+}
+
+/// Valida o cabeçalho e preenche formato e níveis de out (sem os blocos).
+static bool readHeader(std::ifstream &in, DdsImage &out)
+{
+	Header h;
+	if (!in.read(reinterpret_cast<char *>(&h), sizeof h) || h.magic != kMagic || h.size != 124 ||
+			!(h.pfFlags & DDPF_FOURCC) || (h.pfFourCC != kDXT1 && h.pfFourCC != kDXT5) ||
+			h.width == 0 || h.height == 0 || h.width > 16384 || h.height > 16384)
+		return false;
+
+	DdsImage img;
+	img.format = (h.pfFourCC == kDXT1) ? DdsFormat::DXT1 : DdsFormat::DXT5;
+	img.blurRadius = (h.reserved1[0] == kBlur) ? static_cast<int>(h.reserved1[1]) : 0;
+	const std::uint32_t mips = (h.flags & DDSD_MIPMAPCOUNT) && h.mipCount > 0 ? h.mipCount : 1;
+
+	int w = static_cast<int>(h.width), ht = static_cast<int>(h.height);
+	std::size_t offset = 0;
+	for (std::uint32_t i = 0; i < mips && i < 16; ++i)
+	{
+		const std::size_t size = ddsLevelSize(img.format, w, ht);
+		img.levels.push_back({w, ht, offset, size});
+		offset += size;
+		w = (w > 1) ? w / 2 : 1;
+		ht = (ht > 1) ? ht / 2 : 1;
+	}
+
+	out = std::move(img);
+	return true;
+}
+
+bool loadDdsHeader(const std::string &path, DdsImage &out)
+{
+	std::ifstream in(path, std::ios::binary);
+	return in && readHeader(in, out);
+}
+
+bool loadDds(const std::string &path, DdsImage &out)
+{
+	std::ifstream in(path, std::ios::binary);
+	DdsImage img;
+	if (!in || !readHeader(in, img))
+		return false;
+
+	const DdsLevel &last = img.levels.back();
+	img.data.resize(last.offset + last.size);
+	if (!in.read(reinterpret_cast<char *>(img.data.data()), static_cast<std::streamsize>(img.data.size())))
+		return false;
+
+	out = std::move(img);
+	return true;
+}
+
+bool saveDds(const std::string &path, const DdsImage &img)
+{
+	if (img.levels.empty())
+		return false;
+
+	Header h;
+	std::memset(&h, 0, sizeof h);
+	h.magic = kMagic;
+	h.size = 124;
+	h.flags = DDSD_CAPS | DDSD_HEIGHT | DDSD_WIDTH | DDSD_PIXELFORMAT | DDSD_LINEARSIZE;
+	h.width = static_cast<std::uint32_t>(img.levels[0].width);
+	h.height = static_cast<std::uint32_t>(img.levels[0].height);
+	h.linearSize = static_cast<std::uint32_t>(img.levels[0].size);
+	h.pfSize = 32;
+	h.pfFlags = DDPF_FOURCC;
+	h.pfFourCC = (img.format == DdsFormat::DXT1) ? kDXT1 : kDXT5;
+	h.caps1 = DDSCAPS_TEXTURE;
+	if (img.blurRadius > 0)
+	{
+		h.reserved1[0] = kBlur;
+		h.reserved1[1] = static_cast<std::uint32_t>(img.blurRadius);
+	}
+	if (img.levels.size() > 1)
+	{
+		h.flags |= DDSD_MIPMAPCOUNT;
+		h.mipCount = static_cast<std::uint32_t>(img.levels.size());
+		h.caps1 |= DDSCAPS_COMPLEX | DDSCAPS_MIPMAP;
+	}
+
+	std::ofstream out(path, std::ios::binary);
+	out.write(reinterpret_cast<const char *>(&h), sizeof h);
+	out.write(reinterpret_cast<const char *>(img.data.data()), static_cast<std::streamsize>(img.data.size()));
+	return static_cast<bool>(out);
+}
@@ -0,0 +1,60 @@
+#pragma once
+/*
+------------------------------------------------------------------------------
+ Dds.h  –  Leitura e gravação de texturas DXT1/DXT5 em arquivos .dds
+------------------------------------------------------------------------------
+ Formato produzido pelo TextureCooker e lido pelo TextureLoader: cabeçalho DDS
+ padrão (128 bytes) seguido da cadeia completa de mipmaps já comprimida.
+ As linhas de cada nível estão na ordem do OpenGL (de baixo para cima), como
+ a imagem que stb_image entrega com a inversão vertical ligada – o jogo envia
+ os blocos direto com glCompressedTexImage2D, sem decodificar nada.
+
+ O raio de desfoque aplicado antes de comprimir (TextureCooker --blur) fica
+ em campos reservados do cabeçalho, que outros leitores ignoram; o jogo
+ recusa um .dds cozido com raio diferente do que pede.
+
+ Não depende de OpenGL: o TextureLoader traduz DdsFormat para a constante GL.
+------------------------------------------------------------------------------*/
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+enum class DdsFormat
+{
+	DXT1, ///< RGB, 8 bytes por bloco 4×4 (alfa ignorado)
+	DXT5	///< RGBA, 16 bytes por bloco 4×4
+};
+
+/// Um nível da cadeia de mipmaps, como fatia de DdsImage::data.
+struct DdsLevel
+{
+	int width, height;
+	std::size_t offset, size;
+};
+
+struct DdsImage
+{
+	DdsFormat format = DdsFormat::DXT1;
+	int blurRadius = 0;							 ///< desfoque aplicado antes de comprimir (0 = nenhum)
+	std::vector<DdsLevel> levels;		///< levels[0] = imagem em tamanho cheio
+	std::vector<unsigned char> data; ///< blocos de todos os níveis, em sequência
+};
+
+/// Arquivo cozido de uma imagem: "pasta/nome.jpg" → "pasta/nome.dds". O
+/// TextureCooker grava e o TextureLoader procura sempre por este nome.
+std::string cookedPath(const std::string &sourcePath);
+
+/// Bytes de um nível w×h comprimido (blocos 4×4, bordas arredondadas para cima).
+std::size_t ddsLevelSize(DdsFormat format, int width, int height);
+
+/// Lê um .dds DXT1/DXT5. Retorna false (sem mensagens) se o arquivo não
+/// existir ou usar outro formato.
+bool loadDds(const std::string &path, DdsImage &out);
+
+/// Só o cabeçalho de um .dds: formato e níveis em out, sem ler os blocos
+/// (out.data fica vazio). Serve para escolher o formato antes de carregar.
+bool loadDdsHeader(const std::string &path, DdsImage &out);
+
+/// Grava img (cabeçalho + níveis). Retorna false se não conseguir escrever.
+bool saveDds(const std::string &path, const DdsImage &img);
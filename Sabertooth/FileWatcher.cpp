@@ -0,0 +1,120 @@
+#include "FileWatcher.h"
+#include <algorithm>
+#ifdef __linux__
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+/*
+------------------------------------------------------------------------------
+ FileWatcher.cpp  –  Implementação (inotify ou varredura por data)
+------------------------------------------------------------------------------*/
+
+namespace fs = std::filesystem;
+
+static fs::file_time_type stampOf(const std::string &path)
+{
+	std::error_code ec;
+	const fs::file_time_type t = fs::last_write_time(path, ec);
+	return ec ? fs::file_time_type::min() : t;
+}
+
+/// Pasta de um caminho ("." se não houver).
+static std::string dirOf(const std::string &path)
+{
+	const fs::path parent = fs::path(path).parent_path();
+	return parent.empty() ? std::string(".") : parent.string();
+}
+
+FileWatcher::FileWatcher()
+{
+#ifdef __linux__
+	inotifyFd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+#endif
+}
+
+FileWatcher::~FileWatcher()
+{
+#ifdef __linux__
+	if (inotifyFd >= 0)
+		close(inotifyFd);
+#endif
+}
+
+void FileWatcher::add(const std::string &path)
+{
+	files.push_back({path, stampOf(path)});
+
+#ifdef __linux__
+	if (inotifyFd < 0)
+		return;
+	const std::string dir = dirOf(path);
+	const bool known = std::any_of(watchedDirs.begin(), watchedDirs.end(),
+																 [&](const auto &kv)
+																 { return kv.second == dir; });
+	if (known)
+		return;
+	const int wd = inotify_add_watch(inotifyFd, dir.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE);
+	if (wd >= 0)
+		watchedDirs[wd] = dir;
+	else
+	{
+		// Pasta inacessível ao inotify: tudo passa para a varredura.
+		close(inotifyFd);
+		inotifyFd = -1;
+		watchedDirs.clear();
+	}
+#endif
+}
+
+std::vector<std::string> FileWatcher::poll()
+{
+	return (inotifyFd >= 0) ? pollInotify() : pollScan();
+}
+
+std::vector<std::string> FileWatcher::pollInotify()
+{
+	std::vector<std::string> changed;
+#ifdef __linux__
+	alignas(inotify_event) char buf[4096];
+	for (;;)
+	{
+		const ssize_t n = read(inotifyFd, buf, sizeof buf);
+		if (n <= 0)
+			break; // EAGAIN: nada pendente
+		for (ssize_t off = 0; off < n;)
+		{
+			const auto *ev = reinterpret_cast<const inotify_event *>(buf + off);
+			off += static_cast<ssize_t>(sizeof(inotify_event) + ev->len);
+			const auto dir = watchedDirs.find(ev->wd);
+			if (dir == watchedDirs.end() || ev->len == 0)
+				continue;
+
+			for (const Entry &e : files)
+				if (dirOf(e.path) == dir->second && fs::path(e.path).filename() == ev->name &&
+						std::find(changed.begin(), changed.end(), e.path) == changed.end())
+					changed.push_back(e.path);
+		}
+	}
+#endif
+	return changed;
+}
+
+std::vector<std::string> FileWatcher::pollScan()
+{
+	std::vector<std::string> changed;
+	const auto now = std::chrono::steady_clock::now();
+	if (now < nextScan)
+		return changed;
+	nextScan = now + kScanInterval;
+
+	for (Entry &e : files)
+	{
+		const fs::file_time_type t = stampOf(e.path);
+		if (t != e.stamp)
+		{
+			e.stamp = t;
+			changed.push_back(e.path);
+		}
+	}
+	return changed;
+}
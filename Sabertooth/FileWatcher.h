@@ -0,0 +1,49 @@
+#pragma once
+/*
+------------------------------------------------------------------------------
+ FileWatcher.h  –  Avisa quando arquivos do disco mudam (sem bloquear)
+------------------------------------------------------------------------------
+ No Linux usa inotify sobre as pastas dos arquivos vigiados (pega também os
+ editores que salvam gravando um temporário e renomeando). Nos demais
+ sistemas – ou se o inotify falhar – compara a data de modificação de cada
+ arquivo a cada kScanInterval. poll() é barato o bastante para todo quadro.
+------------------------------------------------------------------------------*/
+
+#include <chrono>
+#include <filesystem>
+#include <map>
+#include <string>
+#include <vector>
+
+class FileWatcher
+{
+public:
+	static constexpr std::chrono::milliseconds kScanInterval{250};
+
+	FileWatcher();
+	~FileWatcher();
+
+	FileWatcher(const FileWatcher &) = delete;
+	FileWatcher &operator=(const FileWatcher &) = delete;
+
+	/// Passa a vigiar `path` (o caminho é devolvido igual por poll()).
+	void add(const std::string &path);
+
+	/// Arquivos vigiados que mudaram desde a chamada anterior.
+	std::vector<std::string> poll();
+
+private:
+	struct Entry
+	{
+		std::string path;
+		std::filesystem::file_time_type stamp; ///< usado só na varredura
+	};
+	std::vector<Entry> files;
+
+	int inotifyFd = -1;									 ///< −1 = varredura por data
+	std::map<int, std::string> watchedDirs; ///< descritor inotify → pasta
+	std::chrono::steady_clock::time_point nextScan{};
+
+	std::vector<std::string> pollInotify();
+	std::vector<std::string> pollScan();
+};
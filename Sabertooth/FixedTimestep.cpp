@@ -0,0 +1,39 @@
+#include "FixedTimestep.h"
+/*
+------------------------------------------------------------------------------
+ FixedTimestep.cpp  –  Implementação do agendador de passo fixo
+------------------------------------------------------------------------------*/
+
+FixedTimestep::FixedTimestep(float hz, int maxStepsPerFrame)
+		: step(1.0f / hz), accumulator(0.0), maxSteps(maxStepsPerFrame)
+{
+}
+
+void FixedTimestep::setRate(float hz)
+{
+	step = 1.0f / hz;
+	accumulator = 0.0;
+}
+
+int FixedTimestep::advance(double frameSeconds)
+{
+	if (frameSeconds > 0.0)
+		accumulator += frameSeconds;
+
+	int n = 0;
+	while (accumulator >= step && n < maxSteps)
+	{
+		accumulator -= step;
+		++n;
+	}
+
+	// Travamento longo: joga fora o excesso em vez de tentar alcançá‑lo.
+	if (n == maxSteps && accumulator >= step)
+		accumulator = 0.0;
+	return n;
+}
+
+float FixedTimestep::alpha() const
+{
+	return static_cast<float>(accumulator / step);
+}
@@ -0,0 +1,38 @@
+#pragma once
+/*
+------------------------------------------------------------------------------
+ FixedTimestep.h  –  Agendador de passo fixo (acumulador) para a física
+------------------------------------------------------------------------------
+ O laço principal mede o tempo real de cada quadro e entrega ao agendador, que
+ acumula esse tempo e devolve quantos passos de duração **constante** devem ser
+ simulados. Assim o resultado de um disparo não depende da taxa de quadros:
+ com a mesma sequência de entradas por passo, a trajetória é idêntica bit a
+ bit. A sobra do acumulador (alpha) serve para o desenho interpolar entre os
+ dois últimos estados simulados.
+------------------------------------------------------------------------------*/
+
+class FixedTimestep
+{
+public:
+	/// @param hz               frequência da simulação (passos por segundo)
+	/// @param maxStepsPerFrame limite de passos por quadro – evita a "espiral
+	///                         da morte" após travamentos longos
+	explicit FixedTimestep(float hz = 120.0f, int maxStepsPerFrame = 8);
+
+	/// Altera a frequência; descarta o tempo acumulado.
+	void setRate(float hz);
+
+	/// Duração de um passo em segundos (1 / hz).
+	[[nodiscard]] float stepSize() const { return step; }
+
+	/// Acumula o tempo real do quadro e retorna quantos passos executar.
+	int advance(double frameSeconds);
+
+	/// Fração [0,1) do próximo passo já decorrida – peso da interpolação.
+	[[nodiscard]] float alpha() const;
+
+private:
+	float step;					///< duração fixa de um passo
+	double accumulator; ///< tempo real ainda não simulado
+	int maxSteps;				///< teto de passos por quadro
+};
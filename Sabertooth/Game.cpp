@@ -1,87 +1,67 @@
 ﻿#include "Game.h"
-#include <iostream>
-#include <cmath>
+#include <algorithm>
 /*
 ------------------------------------------------------------------------------
  Game.cpp  –  Implementa a lógica de jogo declarada em Game.h
+------------------------------------------------------------------------------
+ Nenhuma função aqui faz E/S: o resultado de cada passo é devolvido como
+ StepEvent e quem chama (main.cpp, ferramentas em lote) decide o que exibir.
 ------------------------------------------------------------------------------*/
 
-// ╔═══════════════════════════════════════════════════════════════════════════╗
-// ║                      Definição das Variáveis Globais                      ║
-// ╚═══════════════════════════════════════════════════════════════════════════╝
-
-float projectileX = 0.0f;
-float projectileY = 0.0f;
-bool inFlight = false;
-float angleDeg = 45.0f;
-float power = 5.0f;
-float gravity = 9.8f; ///< força para baixo
-float flightTime = 0.0f;
-
-int currentPlayer = 1; ///< começa com Jogador 1
-glm::vec2 launchPositionP1(-8.0f, 1.5f);
-glm::vec2 launchPositionP2(8.0f, 1.5f);
-
-Player p1{glm::vec2(-8.5f, 1.0f), glm::vec2(1.0f, 1.0f), 0};
-Player p2{glm::vec2(8.0f, 1.0f), glm::vec2(1.0f, 1.0f), 0};
-
-std::vector<Building> buildings; ///< prédios são inseridos em initGame()
-
-// Explosão
-bool showExplosion = false;
-float explosionTime = 0.0f;
-float explosionDuration = 0.5f;
-float explosionX = 0.0f;
-float explosionY = 0.0f;
-
-// ╔═══════════════════════════════════════════════════════════════════════════╗
-// ║                             Funções Auxiliares                            ║
-// ╚═══════════════════════════════════════════════════════════════════════════╝
-
-/**
- * @brief Converte graus em radianos (wrapper para glm::radians).
- */
-static float degToRad(float deg) { return glm::radians(deg); }
-
 // ╔═══════════════════════════════════════════════════════════════════════════╗
 // ║                          Implementação das Funções                        ║
 // ╚═══════════════════════════════════════════════════════════════════════════╝
 
-void initGame()
+void initGame(GameState &s, const char *aimTablePath)
 {
-	/* Cria três prédios – poderíamos gerar aleatoriamente; usamos valores
+	/* Cria três prédios – poderíamos gerar aleatoriamente; usamos valores
 		 fixos para simplicidade. A posição é a base, então altura sobe em Y. */
-	buildings.push_back({{-3.0f, 0.0f}, {2.0f, 3.0f}}); // prédio 1
-	buildings.push_back({{0.0f, 0.0f}, {2.0f, 5.0f}});	// prédio 2
-	buildings.push_back({{3.0f, 0.0f}, {2.0f, 4.0f}});	// prédio 3
+	s.buildings.clear();
+	s.buildings.push_back({{-3.0f, 0.0f}, {2.0f, 3.0f}}); // prédio 1
+	s.buildings.push_back({{0.0f, 0.0f}, {2.0f, 5.0f}});	// prédio 2
+	s.buildings.push_back({{3.0f, 0.0f}, {2.0f, 4.0f}});	// prédio 3
+	s.grid.build(s.buildings);
+
+	// Tabela balística: uma vez por fase, ou lida do arquivo distribuído.
+	auto table = std::make_shared<AimTable>();
+	if (!aimTablePath || !table->load(aimTablePath, AimTable::skylineHash(s)))
+	{
+		table->build(s);
+		if (aimTablePath)
+			table->save(aimTablePath);
+	}
+	s.aimTable = std::move(table);
 
-	resetProjectile();
+	resetProjectile(s);
 }
 
-void resetProjectile()
+void resetProjectile(GameState &s)
 {
-	inFlight = false;
-	flightTime = 0.0f;
+	s.inFlight = false;
+	s.flightTime = 0.0f;
 
-	const glm::vec2 start = (currentPlayer == 1) ? launchPositionP1
-																							 : launchPositionP2;
-	projectileX = start.x;
-	projectileY = start.y;
+	const glm::vec2 start = (s.currentPlayer == 1) ? s.launchPositionP1
+																								 : s.launchPositionP2;
+	s.projectileX = start.x;
+	s.projectileY = start.y;
+
+	// Teleporte: não interpola entre o ponto de impacto e o novo lançador.
+	s.prevProjectileX = s.projectileX;
+	s.prevProjectileY = s.projectileY;
 }
 
-void nextTurn()
+void nextTurn(GameState &s)
 {
-	currentPlayer = (currentPlayer == 1) ? 2 : 1;
-	resetProjectile();
-	std::cout << "Agora é a vez do Jogador " << currentPlayer << "!\n";
+	s.currentPlayer = (s.currentPlayer == 1) ? 2 : 1;
+	resetProjectile(s);
 }
 
-void triggerExplosion(float x, float y)
+void triggerExplosion(GameState &s, float x, float y)
 {
-	showExplosion = true;
-	explosionTime = 0.0f;
-	explosionX = x;
-	explosionY = y;
+	s.showExplosion = true;
+	s.explosionTime = 0.0f;
+	s.explosionX = x;
+	s.explosionY = y;
 }
 
 bool checkCollisionBB(const glm::vec2 &center1, const glm::vec2 &size1,
@@ -111,88 +91,146 @@ bool checkCollisionBB(const glm::vec2 &center1, const glm::vec2 &size1,
 	return true; // caso contrário as caixas se sobrepõem
 }
 
-void updateProjectile(float dt)
+StepEvent applyInput(GameState &s, const Input &in)
 {
-	// Se projétil ainda não foi disparado, ele acompanha o jogador atual.
-	if (!inFlight)
+	Player &me = (s.currentPlayer == 1) ? s.p1 : s.p2;
+
+	// Movimento horizontal somente para o jogador da vez, com limites de faixa
+	me.pos.x += in.move;
+	if (s.currentPlayer == 1)
+		me.pos.x = std::clamp(me.pos.x, -10.0f, -6.0f);
+	else
+		me.pos.x = std::clamp(me.pos.x, 6.0f, 9.0f);
+
+	// Mira absoluta (valores dentro da faixa passam pelo limite inalterados)
+	if (in.setAim)
 	{
-		glm::vec2 base = (currentPlayer == 1) ? p1.pos : p2.pos;
-		projectileX = base.x + 0.5f; // meio do cubo do jogador
-		projectileY = base.y + 0.5f;
-		return; // nada mais a fazer nesta chamada
+		s.angleDeg = std::clamp(in.aimAngleDeg, 0.0f, 90.0f);
+		s.power = std::clamp(in.aimPower, 1.0f, 20.0f);
 	}
 
-	// Avança tempo de voo
-	flightTime += dt;
+	// Ajuste de força e ângulo
+	if (in.powerDelta != 0.0f)
+		s.power = std::clamp(s.power + in.powerDelta, 1.0f, 20.0f);
+	if (in.angleDelta != 0.0f)
+		s.angleDeg = std::clamp(s.angleDeg + in.angleDelta, 0.0f, 90.0f);
 
-	// Converte ângulo para radianos e define direção (p1 atira → direita, p2 → esquerda).
-	const float rad = degToRad(angleDeg);
-	const float dir = (currentPlayer == 1) ? +1.0f : -1.0f;
+	// Disparo
+	if (in.fire && !s.inFlight)
+	{
+		s.inFlight = true;
+		s.flightTime = 0.0f;
+		if (s.currentPlayer == 1)
+			s.launchPositionP1 = launchPoint(s.p1);
+		else
+			s.launchPositionP2 = launchPoint(s.p2);
+		planShot(s);
+		return StepEvent::Fired;
+	}
+	return StepEvent::None;
+}
 
-	// Posição inicial no instante do disparo.
-	const glm::vec2 start = (currentPlayer == 1) ? launchPositionP1
-																							 : launchPositionP2;
+glm::vec2 launchPoint(const Player &p)
+{
+	return {p.pos.x + 0.5f, p.pos.y + 0.5f};
+}
 
-	// Equações de movimento (sem resistência do ar):
-	projectileX = start.x + dir * power * std::cos(rad) * flightTime;
-	projectileY = start.y + power * std::sin(rad) * flightTime - 0.5f * gravity * flightTime * flightTime;
+ShotOutcome firstImpact(float tBuilding, int building, float tPlayer, float tExit)
+{
+	// Empates seguem a ordem antiga de verificação: prédio, oponente, arena.
+	if (tBuilding <= tPlayer && tBuilding <= tExit)
+		return {tBuilding, StepEvent::HitBuilding, building};
+	if (tPlayer <= tExit)
+		return {tPlayer, StepEvent::HitPlayer, -1};
+	return {tExit, StepEvent::OffMap, -1};
+}
 
-	// ------------------------------
-	// 1. Colisão com prédios
-	// ------------------------------
-	for (const Building &b : buildings)
-	{
-		glm::vec2 centerB = b.pos + b.size * 0.5f;
-		glm::vec2 sizeB = b.size;
-		glm::vec2 projCenter(projectileX, projectileY);
-		glm::vec2 projSize(0.4f); // esfera ≈ caixa de 0.4×0.4
-
-		if (checkCollisionBB(centerB, sizeB, projCenter, projSize))
-		{
-			std::cout << "Colidiu em um prédio!\n";
-			triggerExplosion(projectileX, projectileY);
-			nextTurn();
-			return; // encerra a verificação – projétil já parou
-		}
-	}
+ShotOutcome resolveShot(const GameState &s, int shooter, const Trajectory &tr)
+{
+	// Saída da arena e oponente (uma só caixa, teste direto).
+	const float tExit = arenaExitTime(tr);
+	const Player &target = (shooter == 1) ? s.p2 : s.p1;
+	const float tPlayer = sweepAABB(tr, target.pos, target.pos + target.size, kProjectileHalf);
+
+	// Prédios pela grade; só interessam até o primeiro dos outros eventos.
+	int building = -1;
+	const float tBuilding = s.grid.firstHit(tr, std::min(tExit, tPlayer), &building);
+	return firstImpact(tBuilding, building, tPlayer, tExit);
+}
+
+void planShot(GameState &s)
+{
+	// Direção (p1 atira → direita, p2 → esquerda) e posição inicial do disparo.
+	const float dir = (s.currentPlayer == 1) ? +1.0f : -1.0f;
+	const glm::vec2 start = (s.currentPlayer == 1) ? s.launchPositionP1
+																								 : s.launchPositionP2;
+	s.shot = makeTrajectory(start, s.angleDeg, s.power, dir, s.gravity);
+
+	const ShotOutcome o = resolveShot(s, s.currentPlayer, s.shot);
+	s.impactTime = o.time;
+	s.impactEvent = o.event;
+}
 
-	// ------------------------------
-	// 2. Colisão com o oponente
-	// ------------------------------
-	Player &target = (currentPlayer == 1) ? p2 : p1;
-	glm::vec2 centerT = target.pos + target.size * 0.5f;
-	glm::vec2 sizeT = target.size;
-	glm::vec2 projCenter(projectileX, projectileY);
-	glm::vec2 projSize(0.4f);
+StepEvent updateProjectile(GameState &s, float dt)
+{
+	s.prevProjectileX = s.projectileX;
+	s.prevProjectileY = s.projectileY;
 
-	if (checkCollisionBB(centerT, sizeT, projCenter, projSize))
+	// Se projétil ainda não foi disparado, ele acompanha o jogador atual.
+	if (!s.inFlight)
 	{
-		std::cout << "Acertou o Jogador " << ((currentPlayer == 1) ? 2 : 1) << "!\n";
-		(currentPlayer == 1 ? p1.score : p2.score)++;
-		std::cout << "Placar -> P1=" << p1.score << "  P2=" << p2.score << "\n";
-		triggerExplosion(projectileX, projectileY);
-		nextTurn();
-		return;
+		glm::vec2 base = (s.currentPlayer == 1) ? s.p1.pos : s.p2.pos;
+		s.projectileX = base.x + 0.5f; // meio do cubo do jogador
+		s.projectileY = base.y + 0.5f;
+		return StepEvent::None; // nada mais a fazer nesta chamada
 	}
 
-	// ------------------------------
-	// 3. Saiu da arena?
-	// ------------------------------
-	const bool offMap = (projectileX < -12.0f || projectileX > 12.0f ||
-											 projectileY < -5.0f || projectileY > 15.0f);
-	if (offMap)
+	// Avança tempo de voo
+	s.flightTime += dt;
+
+	// Ainda antes do impacto planejado: só posiciona (equações de movimento).
+	if (s.flightTime < s.impactTime)
 	{
-		std::cout << "Projétil saiu do mapa.\n";
-		nextTurn();
+		const glm::vec2 p = s.shot.at(s.flightTime);
+		s.projectileX = p.x;
+		s.projectileY = p.y;
+		return StepEvent::None;
 	}
+
+	// Impacto: o projétil para exatamente no ponto de contato.
+	const glm::vec2 hit = s.shot.at(s.impactTime);
+	s.projectileX = hit.x;
+	s.projectileY = hit.y;
+
+	const StepEvent ev = s.impactEvent;
+	if (ev == StepEvent::HitPlayer)
+		(s.currentPlayer == 1 ? s.p1.score : s.p2.score)++;
+	if (ev != StepEvent::OffMap)
+		triggerExplosion(s, hit.x, hit.y);
+	nextTurn(s);
+	return ev;
 }
 
-void updateExplosion(float dt)
+void updateExplosion(GameState &s, float dt)
 {
-	if (!showExplosion)
+	if (!s.showExplosion)
 		return;
 
-	explosionTime += dt;
-	if (explosionTime >= explosionDuration)
-		showExplosion = false; // encerra animação
-}
\ No newline at end of file
+	s.explosionTime += dt;
+	if (s.explosionTime >= s.explosionDuration)
+		s.showExplosion = false; // encerra animação
+}
+
+glm::vec2 interpolatedProjectile(const GameState &s, float alpha)
+{
+	return glm::mix(glm::vec2(s.prevProjectileX, s.prevProjectileY),
+									glm::vec2(s.projectileX, s.projectileY), alpha);
+}
+
+StepEvent step(GameState &s, const Input &in, float dt)
+{
+	const StepEvent fired = applyInput(s, in);
+	const StepEvent shot = updateProjectile(s, dt);
+	updateExplosion(s, dt);
+	return (shot != StepEvent::None) ? shot : fired;
+}
@@ -5,19 +5,27 @@
 ------------------------------------------------------------------------------
  Neste arquivo definimos:
 	 • Estruturas (struct) que representam Prédios e Jogadores;
-	 • Variáveis globais que guardam o estado do jogo (posição do projétil,
-	 pontuação, explosão etc.);
+	 • GameState: valor que guarda **todo** o estado de uma partida (posição do
+	 projétil, pontuação, explosão etc.);
+	 • Input: comandos de um passo de simulação (mover, mirar, disparar);
 	 • Funções de controle: inicialização, troca de turno, detecção de colisões,
-	 atualização do projétil e da explosão.
+	 atualização do projétil e da explosão, e o passo completo step().
 
  A ideia é manter **toda** a lógica do jogo isolada deste cabeçalho + Game.cpp,
  deixando main.cpp focado somente em inicializar OpenGL, tratar entrada de
- usuário e desenhar.
+ usuário e desenhar. Este módulo não depende de GLFW/OpenGL (apenas GLM) e é
+ compilado na biblioteca estática GorillaCore, que pode rodar partidas sem
+ janela – por exemplo, em ferramentas de balanceamento e testes de regressão.
 ------------------------------------------------------------------------------*/
 
 #include <glm/glm.hpp>
+#include <memory>
 #include <vector>
 
+#include "Ballistics.h"
+#include "Broadphase.h"
+#include "AimTable.h"
+
 // ╔═══════════════════════════════════════════════════════════════════════════╗
 // ║                               Estruturas                                  ║
 // ╚═══════════════════════════════════════════════════════════════════════════╝
@@ -37,62 +45,143 @@ struct Player
 	int score = 0;	///< pontos marcados ao acertar o adversário
 };
 
-// ╔═══════════════════════════════════════════════════════════════════════════╗
-// ║                           Variáveis Globais                               ║
-// ╚═══════════════════════════════════════════════════════════════════════════╝
-
-// Posição atual do projétil (uma esfera branca).
-extern float projectileX;
-extern float projectileY;
-extern bool inFlight;		 ///< indica se o projétil está voando.
-extern float angleDeg;	 ///< ângulo de lançamento em graus.
-extern float power;			 ///< força de lançamento, unidade arbitrária.
-extern float gravity;		 ///< aceleração da gravidade (para baixo).
-extern float flightTime; ///< tempo que o projétil já está em voo.
-
-// Controle de turno: 1 ou 2.
-extern int currentPlayer;
+/// O que aconteceu durante um passo – permite ao chamador registrar mensagens
+/// ou estatísticas sem que a simulação faça E/S.
+enum class StepEvent
+{
+	None,				 ///< nada relevante
+	Fired,			 ///< o jogador da vez disparou
+	HitBuilding, ///< projétil colidiu com um prédio (turno trocado)
+	HitPlayer,	 ///< projétil acertou o oponente (turno trocado)
+	OffMap			 ///< projétil saiu da arena (turno trocado)
+};
 
-// Posições de lançamento, atualizadas toda vez que o jogador se move.
-extern glm::vec2 launchPositionP1;
-extern glm::vec2 launchPositionP2;
+/// Primeiro impacto de um voo: quando, o quê e (se prédio) qual.
+struct ShotOutcome
+{
+	float time = kNoHit;						 ///< tempo de voo do impacto
+	StepEvent event = StepEvent::None; ///< HitBuilding, HitPlayer ou OffMap
+	int building = -1;							 ///< índice em buildings, se HitBuilding
+};
 
-// Instâncias globais dos jogadores.
-extern Player p1;
-extern Player p2;
+/// Estado completo de uma partida. É um tipo valor: pode ser copiado,
+/// comparado campo a campo e simulado em paralelo sem variáveis globais.
+struct GameState
+{
+	// Posição atual do projétil (uma esfera branca).
+	float projectileX = 0.0f;
+	float projectileY = 0.0f;
+	bool inFlight = false;	 ///< indica se o projétil está voando.
+	float angleDeg = 45.0f;	 ///< ângulo de lançamento em graus.
+	float power = 5.0f;			 ///< força de lançamento, unidade arbitrária.
+	float gravity = 9.8f;		 ///< aceleração da gravidade (para baixo).
+	float flightTime = 0.0f; ///< tempo que o projétil já está em voo.
+
+	// Disparo em andamento: trajetória congelada no lançamento e o primeiro
+	// impacto já resolvido analiticamente (ver Ballistics.h).
+	Trajectory shot;
+	float impactTime = kNoHit;							 ///< tempo de voo do impacto
+	StepEvent impactEvent = StepEvent::None; ///< o que acontece em impactTime
+
+	// Posição do projétil no passo anterior (para interpolar o desenho).
+	float prevProjectileX = 0.0f;
+	float prevProjectileY = 0.0f;
+
+	// Controle de turno: 1 ou 2.
+	int currentPlayer = 1;
+
+	// Posições de lançamento, atualizadas toda vez que o jogador dispara.
+	glm::vec2 launchPositionP1{-8.0f, 1.5f};
+	glm::vec2 launchPositionP2{8.0f, 1.5f};
+
+	// Jogadores.
+	Player p1{glm::vec2(-8.5f, 1.0f), glm::vec2(1.0f, 1.0f), 0};
+	Player p2{glm::vec2(8.0f, 1.0f), glm::vec2(1.0f, 1.0f), 0};
+
+	// Vetor que guarda **todos** os prédios do cenário.
+	std::vector<Building> buildings;
+
+	// Grade de consulta dos prédios; reconstruir com grid.build(buildings)
+	// sempre que o vetor acima mudar (initGame já o faz).
+	BuildingGrid grid;
+
+	// Tabela balística do cenário (compartilhada entre cópias do estado).
+	std::shared_ptr<const AimTable> aimTable;
+
+	// Variáveis que controlam a animação de explosão.
+	bool showExplosion = false;
+	float explosionTime = 0.0f;
+	float explosionDuration = 0.5f;
+	float explosionX = 0.0f;
+	float explosionY = 0.0f;
+};
 
-// Vetor que guarda **todos** os prédios do cenário.
-extern std::vector<Building> buildings;
+/// Comandos aplicados em um passo de simulação. Os incrementos já vêm
+/// prontos (quem gera o Input decide a escala); step() só aplica e limita.
+/// Uma mira calculada (IA, partida roteirizada) vai em setAim: aplicar
+/// como incremento (a + (b − a)) nem sempre resulta exatamente em b.
+struct Input
+{
+	float move = 0.0f;			 ///< deslocamento horizontal do jogador da vez
+	float angleDelta = 0.0f; ///< variação do ângulo em graus
+	float powerDelta = 0.0f; ///< variação da força
+	bool setAim = false;		 ///< substitui a mira por aimAngleDeg/aimPower antes dos incrementos
+	float aimAngleDeg = 0.0f;
+	float aimPower = 0.0f;
+	bool fire = false; ///< dispara se o projétil ainda não estiver em voo
+};
 
-// Variáveis que controlam a animação de explosão.
-extern bool showExplosion;
-extern float explosionTime;
-extern float explosionDuration;
-extern float explosionX;
-extern float explosionY;
 
 // ╔═══════════════════════════════════════════════════════════════════════════╗
-// ║                         Funções – Protótipos                              ║
+// ║                         Funções – Protótipos                              ║
 // ╚═══════════════════════════════════════════════════════════════════════════╝
 
-/// Configura o cenário inicial (prédios, jogadores, projétil).
-void initGame();
+/// Configura o cenário inicial (prédios, jogadores, projétil) e a tabela
+/// balística. Com aimTablePath, reaproveita a tabela gravada se ela for do
+/// mesmo cenário; senão a recalcula e grava nesse caminho.
+void initGame(GameState &s, const char *aimTablePath = nullptr);
 
 /// Reposiciona o projétil junto ao jogador atual.
-void resetProjectile();
+void resetProjectile(GameState &s);
 
 /// Alterna o controle para o outro jogador.
-void nextTurn();
+void nextTurn(GameState &s);
 
 /// Ativa a animação de explosão em (x, y).
-void triggerExplosion(float x, float y);
+void triggerExplosion(GameState &s, float x, float y);
 
 /// Verifica sobreposição de duas caixas delimitadoras 2D (eixo‐alinhadas).
 bool checkCollisionBB(const glm::vec2 &center1, const glm::vec2 &size1,
 											const glm::vec2 &center2, const glm::vec2 &size2);
 
-/// Calcula nova posição do projétil e verifica colisões.
-void updateProjectile(float deltaTime);
+/// Aplica os comandos do jogador da vez (movimento, mira e disparo).
+StepEvent applyInput(GameState &s, const Input &in);
+
+/// Ponto de onde o jogador dispara (centro do cubo).
+glm::vec2 launchPoint(const Player &p);
+
+/// Escolhe o primeiro evento entre os tempos de impacto com prédio (e qual),
+/// oponente e saída da arena. Empates: prédio, oponente, arena.
+ShotOutcome firstImpact(float tBuilding, int building, float tPlayer, float tExit);
+
+/// Primeiro impacto de tr disparado por `shooter` (1 ou 2) no cenário de s:
+/// prédio, oponente ou saída da arena. Usado pelo jogo e pelas ferramentas
+/// em lote, garantindo resultados idênticos.
+ShotOutcome resolveShot(const GameState &s, int shooter, const Trajectory &tr);
+
+/// Resolve, no disparo, o instante e o tipo do primeiro impacto do voo.
+void planShot(GameState &s);
+
+/// Avança o projétil; a colisão é só a comparação com o impacto planejado.
+StepEvent updateProjectile(GameState &s, float deltaTime);
 
 /// Atualiza o tempo de vida da explosão.
-void updateExplosion(float deltaTime);
\ No newline at end of file
+void updateExplosion(GameState &s, float deltaTime);
+
+/// Posição do projétil para desenho, interpolada entre os dois últimos passos
+/// (alpha = fração do passo seguinte já decorrida, ver FixedTimestep).
+glm::vec2 interpolatedProjectile(const GameState &s, float alpha);
+
+/// Passo completo da simulação: entrada → projétil → explosão.
+/// Retorna o evento mais relevante ocorrido no passo.
+StepEvent step(GameState &s, const Input &in, float deltaTime);
@@ -40,7 +40,9 @@ float texturedCubeVertices[36 * 5] = {
 std::vector<float> generateSphereVertices(float radius, int stacks, int slices)
 {
 	std::vector<float> v;
-	v.reserve(stacks * slices * 36); // estimativa
+	// Contagem exata: por quad, 2 triângulos × 3 vértices × 6 floats (x,y,z,r,g,b).
+	if (stacks > 0 && slices > 0)
+		v.reserve(static_cast<std::size_t>(stacks) * slices * 6 * 6);
 	const float PI = 3.14159265358979323846f;
 
 	for (int i = 0; i < stacks; ++i)
@@ -87,4 +89,62 @@ std::vector<float> generateSphereVertices(float radius, int stacks, int slices)
 		}
 	}
 	return v;
-}
\ No newline at end of file
+}
+
+IndexedMesh generateIndexedSphere(float radius, int stacks, int slices)
+{
+	IndexedMesh m;
+	const long vertexCount = 2L + static_cast<long>(stacks - 1) * slices;
+	if (stacks < 2 || slices < 3 || vertexCount > 65535)
+		return m;
+
+	const float PI = 3.14159265358979323846f;
+	m.vertices.reserve(static_cast<std::size_t>(vertexCount) * 6);
+	m.indices.reserve(static_cast<std::size_t>(stacks - 1) * slices * 6);
+
+	// Mesma parametrização e mesmo esquema de cor da versão expandida, mas
+	// agora por vértice (i = latitude, j = longitude).
+	auto pushVertex = [&](int i, int j)
+	{
+		const float phi = PI * i / stacks;
+		const float theta = 2 * PI * j / slices;
+		const float c1 = static_cast<float>(i) / stacks;
+		const float c2 = static_cast<float>(j) / slices;
+		m.vertices.insert(m.vertices.end(),
+											{radius * std::sin(phi) * std::cos(theta),
+											 radius * std::cos(phi),
+											 radius * std::sin(phi) * std::sin(theta),
+											 0.8f * c1 + 0.2f, 0.6f * (1.0f - c2) + 0.4f, 0.5f * c2 + 0.2f});
+	};
+
+	// Polo norte (índice 0), anéis intermediários, polo sul (último índice).
+	// Os anéis não repetem a costura: a longitude j = slices volta a j = 0.
+	pushVertex(0, 0);
+	for (int i = 1; i < stacks; ++i)
+		for (int j = 0; j < slices; ++j)
+			pushVertex(i, j);
+	pushVertex(stacks, 0);
+
+	const auto south = static_cast<std::uint16_t>(vertexCount - 1);
+	auto ring = [&](int i, int j)
+	{ return static_cast<std::uint16_t>(1 + (i - 1) * slices + (j % slices)); };
+	auto tri = [&](std::uint16_t a, std::uint16_t b, std::uint16_t c)
+	{ m.indices.insert(m.indices.end(), {a, b, c}); };
+
+	for (int j = 0; j < slices; ++j)
+	{
+		// Calota norte: no original P1 = P4 (polo), sobra só um triângulo.
+		tri(0, ring(1, j), ring(1, j + 1));
+
+		// Faixas intermediárias: P1 → P2 → P3 e P1 → P3 → P4.
+		for (int i = 1; i < stacks - 1; ++i)
+		{
+			tri(ring(i, j), ring(i + 1, j), ring(i + 1, j + 1));
+			tri(ring(i, j), ring(i + 1, j + 1), ring(i, j + 1));
+		}
+
+		// Calota sul: P2 = P3 (polo).
+		tri(ring(stacks - 1, j), south, ring(stacks - 1, j + 1));
+	}
+	return m;
+}
@@ -5,6 +5,7 @@
 				esfera colorida) usados em toda a aplicação.
 ------------------------------------------------------------------------------*/
 
+#include <cstdint>
 #include <vector>
 
 // Array global – 36 vértices, cada um com 5 floats (x,y,z,u,v).
@@ -17,4 +18,20 @@ extern float texturedCubeVertices[36 * 5];
  * @param slices  Número de divisões ao longo da longitude
  * @return        Vetor intercalado (x,y,z,r,g,b) por vértice
  */
-std::vector<float> generateSphereVertices(float radius, int stacks, int slices);
\ No newline at end of file
+std::vector<float> generateSphereVertices(float radius, int stacks, int slices);
+
+/// Malha indexada: vértices sem repetição + índices de 16 bits.
+struct IndexedMesh
+{
+	std::vector<float> vertices;				///< intercalado (x,y,z,r,g,b)
+	std::vector<std::uint16_t> indices; ///< 3 por triângulo
+};
+
+/**
+ * @brief Versão indexada de generateSphereVertices: cada ponto da esfera
+ *        aparece uma única vez (polos inclusive) e os triângulos o
+ *        referenciam por índice. Para 16×16 são 242 vértices em vez de 1536.
+ * @return Malha vazia se a esfera precisar de mais de 65535 vértices
+ *         (limite dos índices de 16 bits).
+ */
+IndexedMesh generateIndexedSphere(float radius, int stacks, int slices);
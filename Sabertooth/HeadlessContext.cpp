@@ -0,0 +1,105 @@
+#include "HeadlessContext.h"
+#include <iostream>
+/*
+------------------------------------------------------------------------------
+ HeadlessContext.cpp  –  Implementação do contexto sem janela via EGL
+------------------------------------------------------------------------------*/
+
+#if __has_include(<EGL/egl.h>)
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+#include <cstring>
+
+/// Display sem superfície: plataforma surfaceless do Mesa, senão o padrão.
+static EGLDisplay openDisplay()
+{
+	const char *ext = eglQueryString(EGL_NO_DISPLAY, EGL_EXTENSIONS);
+	auto getPlatformDisplay = reinterpret_cast<PFNEGLGETPLATFORMDISPLAYEXTPROC>(
+			eglGetProcAddress("eglGetPlatformDisplayEXT"));
+	if (ext && std::strstr(ext, "EGL_MESA_platform_surfaceless") && getPlatformDisplay)
+	{
+		EGLDisplay d = getPlatformDisplay(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, nullptr);
+		if (d != EGL_NO_DISPLAY && eglInitialize(d, nullptr, nullptr))
+			return d;
+	}
+
+	EGLDisplay d = eglGetDisplay(EGL_DEFAULT_DISPLAY);
+	if (d != EGL_NO_DISPLAY && eglInitialize(d, nullptr, nullptr))
+		return d;
+	return EGL_NO_DISPLAY;
+}
+
+bool HeadlessContext::create(int major, int minor)
+{
+	EGLDisplay d = openDisplay();
+	if (d == EGL_NO_DISPLAY)
+	{
+		std::cerr << "[Headless] Nenhum display EGL disponível\n";
+		return false;
+	}
+	display = d;
+
+	const char *ext = eglQueryString(d, EGL_EXTENSIONS);
+	if (!ext || !std::strstr(ext, "EGL_KHR_surfaceless_context") || !eglBindAPI(EGL_OPENGL_API))
+	{
+		std::cerr << "[Headless] EGL sem OpenGL ou sem EGL_KHR_surfaceless_context\n";
+		destroy();
+		return false;
+	}
+
+	// Sem superfície não é preciso escolher config (EGL_KHR_no_config_context);
+	// se a extensão faltar, qualquer config com OpenGL serve.
+	EGLConfig config = EGL_NO_CONFIG_KHR;
+	if (!std::strstr(ext, "EGL_KHR_no_config_context"))
+	{
+		const EGLint want[] = {EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT, EGL_NONE};
+		EGLint n = 0;
+		if (!eglChooseConfig(d, want, &config, 1, &n) || n < 1)
+		{
+			std::cerr << "[Headless] Nenhuma config EGL com OpenGL\n";
+			destroy();
+			return false;
+		}
+	}
+
+	const EGLint attribs[] = {
+			EGL_CONTEXT_MAJOR_VERSION, major,
+			EGL_CONTEXT_MINOR_VERSION, minor,
+			EGL_CONTEXT_OPENGL_PROFILE_MASK, EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT,
+			EGL_NONE};
+	EGLContext c = eglCreateContext(d, config, EGL_NO_CONTEXT, attribs);
+	if (c == EGL_NO_CONTEXT || !eglMakeCurrent(d, EGL_NO_SURFACE, EGL_NO_SURFACE, c))
+	{
+		std::cerr << "[Headless] Não foi possível criar um contexto OpenGL " << major << "." << minor
+							<< " core (erro EGL 0x" << std::hex << eglGetError() << std::dec << ")\n";
+		if (c != EGL_NO_CONTEXT)
+			eglDestroyContext(d, c);
+		destroy();
+		return false;
+	}
+	context = c;
+	return true;
+}
+
+void HeadlessContext::destroy()
+{
+	if (!display)
+		return;
+	eglMakeCurrent(display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+	if (context)
+		eglDestroyContext(display, context);
+	eglTerminate(display);
+	display = context = nullptr;
+}
+
+#else // sem EGL
+
+bool HeadlessContext::create(int, int)
+{
+	std::cerr << "[Headless] Compilado sem EGL: modo sem janela indisponível nesta plataforma\n";
+	return false;
+}
+
+void HeadlessContext::destroy() {}
+
+#endif
@@ -0,0 +1,32 @@
+#pragma once
+/*
+------------------------------------------------------------------------------
+ HeadlessContext.h  –  Contexto OpenGL sem janela (EGL "surfaceless")
+------------------------------------------------------------------------------
+ Para medir o desenho em máquinas sem monitor nem GPU (integração contínua):
+ cria um contexto OpenGL core pelo EGL sem superfície alguma – com o Mesa, o
+ rasterizador em software llvmpipe serve. Tudo é desenhado em framebuffers
+ próprios (RenderTarget), já que não existe framebuffer padrão.
+
+ Tenta, nesta ordem, a plataforma EGL_PLATFORM_SURFACELESS_MESA e o display
+ padrão com EGL_KHR_surfaceless_context. Compilado sem os cabeçalhos do EGL
+ (ex.: Windows), create() apenas informa que o modo não está disponível.
+------------------------------------------------------------------------------*/
+
+class HeadlessContext
+{
+public:
+	HeadlessContext() = default;
+	~HeadlessContext() { destroy(); }
+
+	HeadlessContext(const HeadlessContext &) = delete;
+	HeadlessContext &operator=(const HeadlessContext &) = delete;
+
+	/// Cria o contexto core `major.minor` e o torna atual nesta thread.
+	bool create(int major, int minor);
+	void destroy();
+
+private:
+	void *display = nullptr; ///< EGLDisplay
+	void *context = nullptr; ///< EGLContext
+};
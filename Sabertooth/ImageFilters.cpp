@@ -0,0 +1,87 @@
+#include "ImageFilters.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <vector>
+/*
+------------------------------------------------------------------------------
+ ImageFilters.cpp  –  Implementação dos filtros
+------------------------------------------------------------------------------*/
+
+void gaussianBlurRGBA(unsigned char *rgba, int w, int h, int radius)
+{
+	if (radius <= 0 || w <= 0 || h <= 0)
+		return;
+
+	// Núcleo 1D normalizado: 2·radius + 1 pesos.
+	const float sigma = radius / 2.0f;
+	std::vector<float> k(static_cast<size_t>(2 * radius + 1));
+	float sum = 0.0f;
+	for (int i = -radius; i <= radius; ++i)
+		sum += k[i + radius] = std::exp(-(i * i) / (2.0f * sigma * sigma));
+	for (float &v : k)
+		v /= sum;
+
+	auto clampi = [](int v, int lo, int hi)
+	{ return v < lo ? lo : (v > hi ? hi : v); };
+
+	// Passo horizontal em float (sem arredondar entre os passos).
+	std::vector<float> tmp(static_cast<size_t>(w) * h * 4);
+	for (int y = 0; y < h; ++y)
+		for (int x = 0; x < w; ++x)
+		{
+			float acc[4] = {0, 0, 0, 0};
+			for (int i = -radius; i <= radius; ++i)
+			{
+				const unsigned char *p = rgba + (static_cast<size_t>(y) * w + clampi(x + i, 0, w - 1)) * 4;
+				for (int c = 0; c < 4; ++c)
+					acc[c] += k[i + radius] * p[c];
+			}
+			for (int c = 0; c < 4; ++c)
+				tmp[(static_cast<size_t>(y) * w + x) * 4 + c] = acc[c];
+		}
+
+	// Passo vertical, de volta para 8 bits.
+	for (int y = 0; y < h; ++y)
+		for (int x = 0; x < w; ++x)
+		{
+			float acc[4] = {0, 0, 0, 0};
+			for (int i = -radius; i <= radius; ++i)
+			{
+				const float *p = &tmp[(static_cast<size_t>(clampi(y + i, 0, h - 1)) * w + x) * 4];
+				for (int c = 0; c < 4; ++c)
+					acc[c] += k[i + radius] * p[c];
+			}
+			for (int c = 0; c < 4; ++c)
+				rgba[(static_cast<size_t>(y) * w + x) * 4 + c] = static_cast<unsigned char>(acc[c] + 0.5f);
+		}
+}
+
+unsigned char *resizeRGBA(const unsigned char *src, int sw, int sh, int dw, int dh)
+{
+	auto *dst = static_cast<unsigned char *>(std::malloc(static_cast<size_t>(dw) * dh * 4));
+	if (!dst)
+		return nullptr;
+	for (int y = 0; y < dh; ++y)
+	{
+		const float fy = std::max(0.0f, (y + 0.5f) * sh / dh - 0.5f);
+		const int y0 = std::min(static_cast<int>(fy), sh - 1), y1 = std::min(y0 + 1, sh - 1);
+		const float ty = fy - y0;
+		for (int x = 0; x < dw; ++x)
+		{
+			const float fx = std::max(0.0f, (x + 0.5f) * sw / dw - 0.5f);
+			const int x0 = std::min(static_cast<int>(fx), sw - 1), x1 = std::min(x0 + 1, sw - 1);
+			const float tx = fx - x0;
+			for (int c = 0; c < 4; ++c)
+			{
+				auto at = [&](int px, int py)
+				{ return static_cast<float>(src[(static_cast<size_t>(py) * sw + px) * 4 + c]); };
+				const float top = at(x0, y0) + (at(x1, y0) - at(x0, y0)) * tx;
+				const float bottom = at(x0, y1) + (at(x1, y1) - at(x0, y1)) * tx;
+				dst[(static_cast<size_t>(y) * dw + x) * 4 + c] =
+						static_cast<unsigned char>(top + (bottom - top) * ty + 0.5f);
+			}
+		}
+	}
+	return dst;
+}
@@ -0,0 +1,27 @@
+#pragma once
+/*
+------------------------------------------------------------------------------
+ ImageFilters.h  –  Filtros de imagem aplicados na CPU, uma única vez
+------------------------------------------------------------------------------
+ Usados na carga (thread de trabalho do TextureLoader) e no TextureCooker,
+ para que efeitos sobre imagens estáticas – como o desfoque do fundo – não
+ custem nada por quadro. Sem dependência de OpenGL.
+------------------------------------------------------------------------------*/
+
+/**
+ * @brief Desfoque gaussiano separável (horizontal, depois vertical), no lugar.
+ * @param rgba    pixels RGBA de 8 bits, w×h
+ * @param radius  alcance do núcleo em pixels (σ = radius / 2); 0 não altera
+ *
+ * Bordas repetem o último pixel. Custo O(w·h·radius), independente de ser
+ * aplicado a uma textura grande ou pequena na tela.
+ */
+void gaussianBlurRGBA(unsigned char *rgba, int w, int h, int radius);
+
+/**
+ * @brief Redimensiona uma imagem RGBA de 8 bits (bilinear, centros de pixel
+ *        alinhados).
+ * @return  dw×dh pixels alocados com malloc (libere com free ou
+ *          stbi_image_free), ou nullptr sem memória
+ */
+unsigned char *resizeRGBA(const unsigned char *src, int sw, int sh, int dw, int dh);
@@ -0,0 +1,120 @@
+#include "InputSystem.h"
+#include <algorithm>
+/*
+------------------------------------------------------------------------------
+ InputSystem.cpp  –  Callbacks do GLFW, fila de eventos e integração no tempo
+------------------------------------------------------------------------------*/
+
+InputSystem::InputSystem()
+{
+	actionOf.fill(-1);
+}
+
+void InputSystem::attach(GLFWwindow *window)
+{
+	glfwSetWindowUserPointer(window, this);
+	glfwSetKeyCallback(window, &InputSystem::onKey);
+	glfwSetWindowFocusCallback(window, &InputSystem::onFocus);
+	consumedUntil = glfwGetTime();
+}
+
+void InputSystem::bind(int key, Action action)
+{
+	if (key >= 0 && key <= GLFW_KEY_LAST)
+		actionOf[key] = static_cast<std::int8_t>(action);
+}
+
+// ╔═══════════════════════════════════════════════════════════════════════════╗
+// ║                           Callbacks e Fila                                ║
+// ╚═══════════════════════════════════════════════════════════════════════════╝
+
+void InputSystem::onKey(GLFWwindow *window, int key, int, int action, int)
+{
+	auto *self = static_cast<InputSystem *>(glfwGetWindowUserPointer(window));
+	if (!self || key < 0 || key > GLFW_KEY_LAST || action == GLFW_REPEAT)
+		return;
+	self->push(glfwGetTime(), key, action == GLFW_PRESS);
+}
+
+void InputSystem::onFocus(GLFWwindow *window, int focused)
+{
+	// Sem foco o GLFW não entrega o "soltou": a tecla ficaria presa.
+	auto *self = static_cast<InputSystem *>(glfwGetWindowUserPointer(window));
+	if (self && !focused)
+		self->releaseAll(glfwGetTime());
+}
+
+void InputSystem::push(double time, int key, bool pressed)
+{
+	if (actionOf[key] < 0 || keyDown[key] == pressed)
+		return; // tecla sem ação, ou transição repetida
+
+	// Cada tecla apertada reserva a vaga do seu "soltou": a fila cheia só
+	// descarta apertos, nunca deixa uma tecla presa.
+	if (pressed)
+	{
+		const int down = static_cast<int>(std::count(keyDown.begin(), keyDown.end(), true));
+		if (count + 1 + down + 1 > kCapacity)
+		{
+			++droppedCount;
+			return;
+		}
+	}
+
+	keyDown[key] = pressed;
+	events[(head + count) % kCapacity] = {time, static_cast<std::int16_t>(key), pressed};
+	++count;
+}
+
+void InputSystem::releaseAll(double time)
+{
+	for (int key = 0; key <= GLFW_KEY_LAST; ++key)
+		if (keyDown[key])
+			push(time, key, false);
+}
+
+// ╔═══════════════════════════════════════════════════════════════════════════╗
+// ║                                 Consumo                                   ║
+// ╚═══════════════════════════════════════════════════════════════════════════╝
+
+ActionSample InputSystem::consume(double until)
+{
+	ActionSample s;
+
+	// Soma o tempo decorrido até `t` às ações ativas e avança o cursor.
+	auto advanceTo = [&](double t)
+	{
+		if (t <= consumedUntil)
+			return;
+		const float span = static_cast<float>(t - consumedUntil);
+		for (int a = 0; a < static_cast<int>(Action::Count); ++a)
+			if (activeKeys[a] > 0)
+				s.held[a] += span;
+		consumedUntil = t;
+	};
+
+	while (count > 0 && events[head].time <= until)
+	{
+		const KeyEvent e = events[head];
+		head = (head + 1) % kCapacity;
+		--count;
+
+		advanceTo(e.time);
+		if (keyDownConsumed[e.key] == e.pressed)
+			continue;
+		keyDownConsumed[e.key] = e.pressed;
+
+		const int a = actionOf[e.key];
+		if (a < 0)
+			continue; // associação desfeita depois do evento
+		if (e.pressed)
+		{
+			++activeKeys[a];
+			++s.presses[a];
+		}
+		else
+			activeKeys[a] = std::max(0, activeKeys[a] - 1);
+	}
+	advanceTo(until);
+	return s;
+}
@@ -0,0 +1,102 @@
+#pragma once
+/*
+------------------------------------------------------------------------------
+ InputSystem.h  –  Teclado por eventos: fila com instante e mapa de ações
+------------------------------------------------------------------------------
+ glfwGetKey só diz se a tecla está apertada no instante da consulta: um
+ toque entre duas consultas se perde, e somar um incremento fixo por quadro
+ faz a velocidade da mira depender da taxa de quadros. Aqui o callback de
+ teclado do GLFW grava cada transição (tecla, apertou/soltou, instante)
+ numa fila circular; cada passo fixo da física consome os eventos até o seu
+ instante final e recebe, por ação:
+   • held:    segundos em que a ação esteve ativa dentro do passo;
+   • presses: quantas vezes foi apertada (borda de subida).
+ Quem chama multiplica held pela taxa da ação (unidades por segundo), então
+ o resultado é o mesmo a 30 ou a 300 quadros por segundo.
+
+ O instante é o glfwGetTime() do callback, ou seja, do glfwPollEvents que
+ entregou o evento – a resolução é a de uma consulta por quadro, mas a
+ ordem e a duração dos toques são preservadas. Repetições automáticas do
+ sistema (GLFW_REPEAT) são ignoradas; perder o foco solta todas as teclas.
+
+ Os callbacks rodam na thread principal, dentro de glfwPollEvents: a fila
+ não precisa de sincronização.
+------------------------------------------------------------------------------*/
+
+#include <GLFW/glfw3.h>
+#include <array>
+#include <cstdint>
+
+/// Ações do jogo; as teclas são associadas a elas com bind().
+enum class Action : std::uint8_t
+{
+	MoveLeft,
+	MoveRight,
+	AngleDown,
+	AngleUp,
+	PowerDown,
+	PowerUp,
+	Fire,
+	Quit,
+	Count
+};
+
+/// O que aconteceu com cada ação num intervalo de tempo.
+struct ActionSample
+{
+	std::array<float, static_cast<int>(Action::Count)> held{};	///< segundos ativa
+	std::array<int, static_cast<int>(Action::Count)> presses{}; ///< apertos
+
+	[[nodiscard]] float heldFor(Action a) const { return held[static_cast<int>(a)]; }
+	[[nodiscard]] bool pressed(Action a) const { return presses[static_cast<int>(a)] > 0; }
+};
+
+class InputSystem
+{
+public:
+	static constexpr int kCapacity = 256; ///< eventos entre dois consumos
+
+	InputSystem();
+
+	/// Instala os callbacks de teclado e foco em `window` (usa o user pointer
+	/// da janela) e começa a contar o tempo a partir de agora.
+	void attach(GLFWwindow *window);
+
+	/// Associa `key` (GLFW_KEY_*) a `action`; várias teclas podem ter a mesma ação.
+	void bind(int key, Action action);
+
+	/// Consome os eventos até o instante `until` (glfwGetTime) e resume o
+	/// intervalo desde o consumo anterior. `until` não pode voltar no tempo.
+	ActionSample consume(double until);
+
+	/// Fim do último intervalo consumido.
+	[[nodiscard]] double cursor() const { return consumedUntil; }
+
+	/// Eventos descartados por fila cheia.
+	[[nodiscard]] std::uint32_t dropped() const { return droppedCount; }
+
+private:
+	struct KeyEvent
+	{
+		double time;
+		std::int16_t key;
+		bool pressed;
+	};
+
+	static void onKey(GLFWwindow *window, int key, int scancode, int action, int mods);
+	static void onFocus(GLFWwindow *window, int focused);
+
+	void push(double time, int key, bool pressed);
+	void releaseAll(double time);
+
+	std::array<KeyEvent, kCapacity> events{};
+	int head = 0, count = 0; ///< fila circular: início e tamanho
+
+	std::array<std::int8_t, GLFW_KEY_LAST + 1> actionOf{}; ///< -1 = sem ação
+	std::array<bool, GLFW_KEY_LAST + 1> keyDown{};				 ///< já visto pelo callback
+	std::array<bool, GLFW_KEY_LAST + 1> keyDownConsumed{}; ///< já aplicado por consume()
+	std::array<int, static_cast<int>(Action::Count)> activeKeys{}; ///< teclas apertadas por ação
+
+	double consumedUntil = 0.0;
+	std::uint32_t droppedCount = 0;
+};
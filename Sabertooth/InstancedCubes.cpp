@@ -0,0 +1,102 @@
+#include "InstancedCubes.h"
+#include "Logger.h"
+#include <cstddef>
+#include <cstring>
+/*
+------------------------------------------------------------------------------
+ InstancedCubes.cpp  –  Implementação do desenho instanciado
+------------------------------------------------------------------------------*/
+
+/// VAO com o cubo nos atributos 0 e 1 e o formato das instâncias (2 e 3);
+/// o buffer de instâncias é ligado depois, em kInstanceBinding.
+static GLuint makeVertexArray(GLuint cubeVBO, GLuint instanceBinding)
+{
+	GLuint vao = 0;
+	glGenVertexArrays(1, &vao);
+	glBindVertexArray(vao);
+
+	// Atributos por vértice: mesmo layout do cubo texturizado (x,y,z,u,v).
+	glBindBuffer(GL_ARRAY_BUFFER, cubeVBO);
+	glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 5 * sizeof(float), (void *)0);
+	glEnableVertexAttribArray(0);
+	glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 5 * sizeof(float), (void *)(3 * sizeof(float)));
+	glEnableVertexAttribArray(1);
+
+	// Atributos por instância: avançam uma vez por cubo (divisor 1). Só o
+	// formato fica no VAO; o buffer é ligado por quem conhece o deslocamento.
+	glVertexAttribFormat(2, 4, GL_FLOAT, GL_FALSE, offsetof(CubeInstance, rect));
+	glVertexAttribBinding(2, instanceBinding);
+	glEnableVertexAttribArray(2);
+	glVertexAttribFormat(3, 1, GL_FLOAT, GL_FALSE, offsetof(CubeInstance, layer));
+	glVertexAttribBinding(3, instanceBinding);
+	glEnableVertexAttribArray(3);
+	glVertexBindingDivisor(instanceBinding, 1);
+
+	glBindVertexArray(0);
+	return vao;
+}
+
+void InstancedCubes::init(GLuint cubeVBO, StreamBuffer &target)
+{
+	stream = &target;
+	vao = makeVertexArray(cubeVBO, kInstanceBinding);
+	staticVao = makeVertexArray(cubeVBO, kInstanceBinding);
+}
+
+void InstancedCubes::destroy()
+{
+	glDeleteVertexArrays(1, &vao);
+	glDeleteVertexArrays(1, &staticVao);
+	glDeleteBuffers(1, &staticBuffer);
+	vao = staticVao = staticBuffer = 0;
+	staticCount = 0;
+	uploaded = 0;
+}
+
+void InstancedCubes::setStatic(const std::vector<CubeInstance> &fixed)
+{
+	// Imutável (glBufferStorage sem flags): o driver pode deixá-lo na memória
+	// de vídeo. Trocar a fase cria outro.
+	glDeleteBuffers(1, &staticBuffer);
+	staticBuffer = 0;
+	staticCount = 0;
+	if (fixed.empty())
+		return;
+
+	glGenBuffers(1, &staticBuffer);
+	glBindBuffer(GL_ARRAY_BUFFER, staticBuffer);
+	glBufferStorage(GL_ARRAY_BUFFER, static_cast<GLsizeiptr>(fixed.size() * sizeof(CubeInstance)), fixed.data(), 0);
+	glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+	glBindVertexArray(staticVao);
+	glBindVertexBuffer(kInstanceBinding, staticBuffer, 0, sizeof(CubeInstance));
+	glBindVertexArray(0);
+	staticCount = static_cast<GLsizei>(fixed.size());
+}
+
+void InstancedCubes::add(const glm::vec2 &pos, const glm::vec2 &size, float layer)
+{
+	instances.push_back({glm::vec4(pos, size), layer});
+}
+
+void InstancedCubes::upload()
+{
+	uploaded = 0;
+	if (instances.empty())
+		return;
+
+	const GLsizeiptr bytes = static_cast<GLsizeiptr>(instances.size() * sizeof(CubeInstance));
+	const StreamSlice slice = stream->alloc(bytes, 16);
+	if (!slice.ptr)
+	{
+		static LogRate rate(1.0f); // repetiria a cada quadro
+		Logger::get().write(rate, LogLevel::Warn, "[InstancedCubes] StreamBuffer cheio: %zu instâncias não couberam", instances.size());
+		return;
+	}
+
+	std::memcpy(slice.ptr, instances.data(), static_cast<size_t>(bytes));
+	glBindVertexArray(vao);
+	glBindVertexBuffer(kInstanceBinding, stream->id(), slice.offset, sizeof(CubeInstance));
+	glBindVertexArray(0);
+	uploaded = size();
+}
@@ -0,0 +1,74 @@
+#pragma once
+/*
+------------------------------------------------------------------------------
+ InstancedCubes.h  –  Desenho instanciado dos cubos (prédios e jogadores)
+------------------------------------------------------------------------------
+ Em vez de um glDrawArrays por cubo (com bind de VAO, textura e uma matriz
+ model enviada por uniform), cada cubo vira uma instância: retângulo
+ (posição da base + tamanho) e camada de textura num buffer de instâncias.
+ O vertex shader monta a transformação a partir do retângulo e um único
+ glDrawArraysInstanced desenha um grupo inteiro.
+
+ Há dois grupos, cada um com seu VAO:
+   • fixas (os prédios): enviadas uma vez, ao carregar a fase, para um
+     buffer imutável – uma cidade com milhares de prédios não disputa a
+     fatia do quadro no StreamBuffer;
+   • do quadro (os jogadores): escritas direto numa fatia do StreamBuffer
+     a cada quadro (sem glBufferData). Se a fatia não couber, só este
+     grupo deixa de ser desenhado.
+------------------------------------------------------------------------------*/
+
+#include <GL/glew.h>
+#include <glm/glm.hpp>
+#include <vector>
+
+#include "StreamBuffer.h"
+
+/// Dados por instância, lidos pelo vertex shader (locations 2 e 3).
+struct CubeInstance
+{
+	glm::vec4 rect; ///< x, y da base (canto inferior esquerdo), largura, altura
+	float layer;		///< camada de textura
+};
+
+class InstancedCubes
+{
+public:
+	/// Cria os VAOs: atributos do cubo (vbo com 5 floats por vértice) mais os
+	/// atributos por instância, lidos do buffer fixo ou de fatias de `stream`.
+	void init(GLuint cubeVBO, StreamBuffer &stream);
+	void destroy();
+
+	/// Troca as instâncias fixas (ao carregar a fase): copia `fixed` para um
+	/// buffer imutável novo, que não é mais tocado pela CPU.
+	void setStatic(const std::vector<CubeInstance> &fixed);
+
+	/// Recomeça a lista de instâncias do quadro.
+	void clear() { instances.clear(); }
+
+	/// Acrescenta um cubo ao quadro.
+	void add(const glm::vec2 &pos, const glm::vec2 &size, float layer);
+
+	/// Copia as instâncias do quadro para o StreamBuffer (uma vez por
+	/// quadro, entre seus beginFrame() e endFrame()).
+	void upload();
+
+	[[nodiscard]] GLsizei size() const { return static_cast<GLsizei>(instances.size()); }
+
+	/// Para desenhar via RenderQueue: VAO e quantidade de cada grupo.
+	[[nodiscard]] GLuint staticArray() const { return staticVao; }
+	[[nodiscard]] GLsizei staticSize() const { return staticCount; }
+	[[nodiscard]] GLuint vertexArray() const { return vao; }
+	[[nodiscard]] GLsizei uploadedSize() const { return uploaded; }
+
+private:
+	static constexpr GLuint kInstanceBinding = 2; ///< após os atributos 0 e 1
+
+	GLuint vao = 0;			 ///< instâncias do quadro (fatias do stream)
+	GLuint staticVao = 0; ///< instâncias fixas (staticBuffer)
+	GLuint staticBuffer = 0;
+	GLsizei staticCount = 0;
+	StreamBuffer *stream = nullptr;
+	GLsizei uploaded = 0; ///< instâncias que couberam na fatia do quadro
+	std::vector<CubeInstance> instances;
+};
@@ -0,0 +1,341 @@
+#include "Logger.h"
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+/*
+------------------------------------------------------------------------------
+ Logger.cpp  –  Fila MPSC, thread de escrita e saídas do log
+------------------------------------------------------------------------------*/
+
+static_assert((Logger::kCapacity & (Logger::kCapacity - 1)) == 0, "kCapacity deve ser potência de 2");
+
+// ╔═══════════════════════════════════════════════════════════════════════════╗
+// ║                             Funções Auxiliares                            ║
+// ╚═══════════════════════════════════════════════════════════════════════════╝
+
+using Clock = std::chrono::steady_clock;
+static const Clock::time_point gOrigin = Clock::now();
+
+static std::int64_t nowNs()
+{
+	return std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - gOrigin).count();
+}
+
+/// Número pequeno e estável por thread (1, 2, 3...), mais legível que o id do SO.
+static std::uint32_t threadIndex()
+{
+	static std::atomic<std::uint32_t> next{0};
+	thread_local const std::uint32_t index = ++next;
+	return index;
+}
+
+static const char *levelName(LogLevel l)
+{
+	switch (l)
+	{
+	case LogLevel::Debug:
+		return "DEBUG";
+	case LogLevel::Info:
+		return "INFO";
+	case LogLevel::Warn:
+		return "AVISO";
+	default:
+		return "ERRO";
+	}
+}
+
+bool parseLogLevel(const std::string &name, LogLevel &out)
+{
+	static const char *names[] = {"debug", "info", "warn", "error", "off"};
+	for (int i = 0; i < 5; ++i)
+		if (name == names[i])
+		{
+			out = static_cast<LogLevel>(i);
+			return true;
+		}
+	return false;
+}
+
+/// Formata texto + aviso de supressão em r.text, truncando em kMaxText.
+static void format(char (&text)[Logger::kMaxText], std::uint16_t &length,
+									 std::uint32_t suppressed, const char *fmt, va_list args)
+{
+	int n = std::vsnprintf(text, sizeof text, fmt, args);
+	if (n < 0)
+		n = 0;
+	if (n >= static_cast<int>(sizeof text))
+	{
+		n = static_cast<int>(sizeof text) - 1;
+		std::memcpy(text + n - 3, "...", 3);
+	}
+	if (suppressed > 0 && n < static_cast<int>(sizeof text) - 1)
+	{
+		const int extra = std::snprintf(text + n, sizeof text - n, " (+%u suprimidas)", suppressed);
+		n = std::min(n + std::max(extra, 0), static_cast<int>(sizeof text) - 1);
+	}
+	length = static_cast<std::uint16_t>(n);
+}
+
+// ╔═══════════════════════════════════════════════════════════════════════════╗
+// ║                                   LogRate                                 ║
+// ╚═══════════════════════════════════════════════════════════════════════════╝
+
+LogRate::LogRate(float perSecond)
+		: intervalNs(static_cast<std::int64_t>(1e9f / perSecond))
+{
+}
+
+bool LogRate::allow(std::uint32_t &suppressed)
+{
+	const std::int64_t now = nowNs();
+	std::int64_t next = nextNs.load(std::memory_order_relaxed);
+	if (now < next || !nextNs.compare_exchange_strong(next, now + intervalNs, std::memory_order_relaxed))
+	{
+		skipped.fetch_add(1, std::memory_order_relaxed);
+		return false;
+	}
+	suppressed = skipped.exchange(0, std::memory_order_relaxed);
+	return true;
+}
+
+// ╔═══════════════════════════════════════════════════════════════════════════╗
+// ║                                    Logger                                 ║
+// ╚═══════════════════════════════════════════════════════════════════════════╝
+
+Logger &Logger::get()
+{
+	static Logger instance;
+	return instance;
+}
+
+Logger::Logger()
+{
+	for (std::size_t i = 0; i < cells.size(); ++i)
+		cells[i].sequence.store(i, std::memory_order_relaxed);
+}
+
+Logger::~Logger()
+{
+	stop();
+}
+
+bool Logger::start(const Options &options)
+{
+	stop();
+	level.store(options.level, std::memory_order_relaxed);
+	console = options.console;
+
+	bool ok = true;
+	if (!options.binaryPath.empty())
+	{
+		binary = std::fopen(options.binaryPath.c_str(), "wb");
+		if (binary)
+		{
+			const std::uint32_t version = 1;
+			const std::uint64_t startNs = static_cast<std::uint64_t>(
+					std::chrono::duration_cast<std::chrono::nanoseconds>(
+							std::chrono::system_clock::now().time_since_epoch())
+							.count() -
+					nowNs());
+			std::fwrite("GLOG", 1, 4, binary);
+			std::fwrite(&version, sizeof version, 1, binary);
+			std::fwrite(&startNs, sizeof startNs, 1, binary);
+		}
+		else
+		{
+			std::fprintf(stderr, "[Logger] Não foi possível criar %s\n", options.binaryPath.c_str());
+			ok = false;
+		}
+	}
+
+	running.store(true, std::memory_order_release);
+	worker = std::thread(&Logger::run, this);
+	return ok;
+}
+
+void Logger::stop()
+{
+	if (!worker.joinable())
+		return;
+	running.store(false, std::memory_order_release);
+	worker.join();
+	drain(); // o que um produtor publicou enquanto a thread encerrava
+
+	if (binary)
+		std::fclose(binary);
+	binary = nullptr;
+}
+
+void Logger::write(LogLevel l, const char *fmt, ...)
+{
+	if (!enabled(l))
+		return;
+	va_list args;
+	va_start(args, fmt);
+	vwrite(l, fmt, args);
+	va_end(args);
+}
+
+void Logger::vwrite(LogLevel l, const char *fmt, va_list args)
+{
+	if (enabled(l) && !push(l, 0, fmt, args))
+		droppedCount.fetch_add(1, std::memory_order_relaxed);
+}
+
+void Logger::write(LogRate &rate, LogLevel l, const char *fmt, ...)
+{
+	std::uint32_t suppressed = 0;
+	if (!enabled(l) || !rate.allow(suppressed))
+		return;
+	va_list args;
+	va_start(args, fmt);
+	if (!push(l, suppressed, fmt, args))
+		droppedCount.fetch_add(1, std::memory_order_relaxed);
+	va_end(args);
+}
+
+void Logger::writeLines(LogLevel l, const char *prefix, const char *text)
+{
+	if (!enabled(l))
+		return;
+	while (*text)
+	{
+		const char *end = std::strchr(text, '\n');
+		const int length = end ? static_cast<int>(end - text) : static_cast<int>(std::strlen(text));
+		if (length > 0)
+			write(l, "%s%.*s", prefix, length, text);
+		text += length + (end ? 1 : 0);
+	}
+}
+
+bool Logger::push(LogLevel l, std::uint32_t suppressed, const char *fmt, va_list args)
+{
+	// Sem thread de escrita: formata na pilha e escreve já.
+	if (!running.load(std::memory_order_acquire))
+	{
+		Record r;
+		r.timeNs = static_cast<std::uint64_t>(nowNs());
+		r.thread = threadIndex();
+		r.level = l;
+		format(r.text, r.length, suppressed, fmt, args);
+		writeNow(r);
+		return true;
+	}
+
+	// Reserva: a célula está livre quando sua sequência é igual à posição.
+	std::size_t pos = tail.load(std::memory_order_relaxed);
+	Cell *cell;
+	for (;;)
+	{
+		cell = &cells[pos & (kCapacity - 1)];
+		const std::size_t seq = cell->sequence.load(std::memory_order_acquire);
+		const std::intptr_t diff = static_cast<std::intptr_t>(seq) - static_cast<std::intptr_t>(pos);
+		if (diff == 0)
+		{
+			if (tail.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+				break;
+		}
+		else if (diff < 0)
+			return false; // cheia: a thread do Logger ainda não liberou esta volta
+		else
+			pos = tail.load(std::memory_order_relaxed);
+	}
+
+	Record &r = cell->record;
+	r.timeNs = static_cast<std::uint64_t>(nowNs());
+	r.thread = threadIndex();
+	r.level = l;
+	format(r.text, r.length, suppressed, fmt, args);
+	cell->sequence.store(pos + 1, std::memory_order_release); // publica
+	return true;
+}
+
+void Logger::writeNow(const Record &r)
+{
+	std::FILE *out = (r.level >= LogLevel::Warn) ? stderr : stdout;
+	std::fprintf(out, "[%10.3f] %-5s %.*s\n", r.timeNs * 1e-9, levelName(r.level), r.length, r.text);
+}
+
+void Logger::emit(const Record &r)
+{
+	if (console)
+		writeNow(r);
+	if (binary)
+	{
+		std::fwrite(&r.timeNs, sizeof r.timeNs, 1, binary);
+		std::fwrite(&r.thread, sizeof r.thread, 1, binary);
+		std::fwrite(&r.level, sizeof r.level, 1, binary);
+		std::fwrite(&r.length, sizeof r.length, 1, binary);
+		std::fwrite(r.text, 1, r.length, binary);
+	}
+}
+
+int Logger::drain()
+{
+	int count = 0;
+	for (;;)
+	{
+		Cell &cell = cells[head & (kCapacity - 1)];
+		if (cell.sequence.load(std::memory_order_acquire) != head + 1)
+			break; // vazia, ou o produtor ainda está formatando esta célula
+		emit(cell.record);
+		cell.sequence.store(head + kCapacity, std::memory_order_release); // libera para a próxima volta
+		++head;
+		++count;
+	}
+
+	const std::uint64_t lost = droppedCount.load(std::memory_order_relaxed);
+	if (lost != lastDropped)
+	{
+		Record r{};
+		r.timeNs = static_cast<std::uint64_t>(nowNs());
+		r.thread = threadIndex();
+		r.level = LogLevel::Warn;
+		r.length = static_cast<std::uint16_t>(std::snprintf(r.text, sizeof r.text,
+				"[Logger] %llu mensagens descartadas (fila cheia)",
+				static_cast<unsigned long long>(lost - lastDropped)));
+		lastDropped = lost;
+		emit(r);
+		++count;
+	}
+
+	if (count > 0)
+	{
+		if (console)
+		{
+			std::fflush(stdout);
+			std::fflush(stderr);
+		}
+		if (binary)
+			std::fflush(binary);
+	}
+	return count;
+}
+
+void Logger::run()
+{
+	// Sem mensagens, dorme um pouco: acordar por notificação obrigaria os
+	// produtores a tocar num mutex/condition_variable.
+	while (running.load(std::memory_order_acquire))
+		if (drain() == 0)
+			std::this_thread::sleep_for(std::chrono::milliseconds(2));
+	drain();
+}
+
+// ╔═══════════════════════════════════════════════════════════════════════════╗
+// ║                                   Atalhos                                 ║
+// ╚═══════════════════════════════════════════════════════════════════════════╝
+
+#define GORILLA_LOG_SHORTCUT(name, lvl)   \
+	void name(const char *fmt, ...)         \
+	{                                       \
+		va_list args;                         \
+		va_start(args, fmt);                  \
+		Logger::get().vwrite(lvl, fmt, args); \
+		va_end(args);                         \
+	}
+
+GORILLA_LOG_SHORTCUT(logDebug, LogLevel::Debug)
+GORILLA_LOG_SHORTCUT(logInfo, LogLevel::Info)
+GORILLA_LOG_SHORTCUT(logWarn, LogLevel::Warn)
+GORILLA_LOG_SHORTCUT(logError, LogLevel::Error)
@@ -0,0 +1,169 @@
+#pragma once
+/*
+------------------------------------------------------------------------------
+ Logger.h  –  Log assíncrono: quem escreve nunca espera pelo terminal
+------------------------------------------------------------------------------
+ Escrever com std::cout no laço principal trava o quadro sempre que o
+ terminal é lento (segurar uma seta imprimia o ângulo a cada quadro). Aqui
+ cada mensagem é formatada direto numa célula de uma fila circular de
+ tamanho fixo, sem alocação nem mutex, e uma thread de fundo a entrega às
+ saídas:
+   • console: texto com instante e nível (AVISO e ERRO vão para stderr);
+   • binária: registros de tamanho variável num arquivo, para ferramentas.
+
+ Várias threads produzem e só a thread do Logger consome (fila MPSC com
+ número de sequência por célula, no estilo de D. Vyukov). Fila cheia não
+ bloqueia: a mensagem é descartada e contada em dropped(). Mensagens que
+ se repetem a cada quadro passam por um LogRate, que deixa sair no máximo
+ uma por intervalo e informa quantas foram suprimidas.
+
+ Formato do arquivo binário (little-endian):
+     cabeçalho  "GLOG" | u32 versão (1) | u64 início (ns desde a época Unix)
+     registro   u64 instante (ns desde o início) | u32 thread | u8 nível
+                | u16 bytes | texto UTF-8 (sem terminador)
+
+ Uso:
+     Logger::get().start(options);        // no início de main
+     logInfo("Placar P1=%d P2=%d", a, b);
+     Logger::get().stop();                // esvazia a fila antes de sair
+ Sem a thread de escrita (antes de start ou depois de stop), a mensagem é
+ escrita na hora, de forma síncrona.
+------------------------------------------------------------------------------*/
+
+#include <array>
+#include <atomic>
+#include <cstdarg>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <thread>
+
+#if defined(__GNUC__) || defined(__clang__)
+#define GORILLA_PRINTF(fmt, args) __attribute__((format(printf, fmt, args)))
+#else
+#define GORILLA_PRINTF(fmt, args)
+#endif
+
+enum class LogLevel : std::uint8_t
+{
+	Debug,
+	Info,
+	Warn,
+	Error,
+	Off ///< só para setLevel: desliga tudo
+};
+
+/// Converte "debug", "info", "warn", "error" ou "off"; false se desconhecido.
+bool parseLogLevel(const std::string &name, LogLevel &out);
+
+/// Limite de frequência de uma mensagem (um LogRate estático por ponto de
+/// chamada). Seguro entre threads: uma troca atômica decide quem sai.
+class LogRate
+{
+public:
+	explicit LogRate(float perSecond);
+
+	/// true se a mensagem pode sair agora; `suppressed` recebe quantas foram
+	/// barradas desde a última que saiu.
+	bool allow(std::uint32_t &suppressed);
+
+private:
+	std::int64_t intervalNs;
+	std::atomic<std::int64_t> nextNs{0};
+	std::atomic<std::uint32_t> skipped{0};
+};
+
+class Logger
+{
+public:
+	static constexpr int kCapacity = 4096; ///< células da fila (potência de 2)
+	static constexpr int kMaxText = 238;	 ///< bytes de texto por mensagem, com o '\0'
+
+	struct Options
+	{
+		LogLevel level = LogLevel::Info;
+		bool console = true;		///< texto em stdout/stderr
+		std::string binaryPath; ///< arquivo binário (vazio = nenhum)
+	};
+
+	/// Instância do processo.
+	static Logger &get();
+
+	~Logger();
+	Logger(const Logger &) = delete;
+	Logger &operator=(const Logger &) = delete;
+
+	/// Abre as saídas e inicia a thread de escrita (mensagens já na fila saem).
+	bool start(const Options &options);
+
+	/// Entrega o que resta na fila, fecha as saídas e encerra a thread.
+	void stop();
+
+	void setLevel(LogLevel l) { level.store(l, std::memory_order_relaxed); }
+	[[nodiscard]] bool enabled(LogLevel l) const
+	{
+		return l >= level.load(std::memory_order_relaxed) && l != LogLevel::Off;
+	}
+
+	/// Mensagem no estilo printf; textos maiores que kMaxText são truncados.
+	void write(LogLevel l, const char *fmt, ...) GORILLA_PRINTF(3, 4);
+	void vwrite(LogLevel l, const char *fmt, va_list args);
+
+	/// Como write, mas sujeito a `rate`.
+	void write(LogRate &rate, LogLevel l, const char *fmt, ...) GORILLA_PRINTF(4, 5);
+
+	/// Uma mensagem por linha de `text` (ex.: log de compilação de shader).
+	void writeLines(LogLevel l, const char *prefix, const char *text);
+
+	/// Mensagens descartadas por fila cheia.
+	[[nodiscard]] std::uint64_t dropped() const { return droppedCount.load(std::memory_order_relaxed); }
+
+private:
+	Logger();
+
+	/// Mensagem já formatada (256 bytes com o cabeçalho).
+	struct Record
+	{
+		std::uint64_t timeNs;
+		std::uint32_t thread;
+		LogLevel level;
+		std::uint16_t length;
+		char text[kMaxText];
+	};
+
+	struct Cell
+	{
+		std::atomic<std::size_t> sequence;
+		Record record;
+	};
+
+	/// Reserva uma célula e formata nela; false se a fila estiver cheia.
+	bool push(LogLevel l, std::uint32_t suppressed, const char *fmt, va_list args);
+
+	/// Escreve na hora, sem fila (sem a thread de escrita).
+	void writeNow(const Record &r);
+
+	/// Consome tudo o que estiver publicado; retorna quantas mensagens.
+	int drain();
+	void emit(const Record &r);
+	void run();
+
+	std::array<Cell, kCapacity> cells;
+	std::atomic<std::size_t> tail{0}; ///< próxima célula a reservar (produtores)
+	std::size_t head = 0;							///< próxima célula a consumir (thread do Logger)
+
+	std::atomic<LogLevel> level{LogLevel::Info};
+	std::atomic<std::uint64_t> droppedCount{0};
+	std::atomic<bool> running{false};
+	std::thread worker;
+
+	bool console = true;
+	std::FILE *binary = nullptr;
+	std::uint64_t lastDropped = 0; ///< já informado pela thread do Logger
+};
+
+// Atalhos para a instância do processo.
+void logDebug(const char *fmt, ...) GORILLA_PRINTF(1, 2);
+void logInfo(const char *fmt, ...) GORILLA_PRINTF(1, 2);
+void logWarn(const char *fmt, ...) GORILLA_PRINTF(1, 2);
+void logError(const char *fmt, ...) GORILLA_PRINTF(1, 2);
@@ -0,0 +1,49 @@
+#include "MeshCache.h"
+#include "Geometry.h"
+/*
+------------------------------------------------------------------------------
+ MeshCache.cpp  –  Implementação do cache de malhas
+------------------------------------------------------------------------------*/
+
+const GpuMesh &MeshCache::sphere(float radius, int stacks, int slices)
+{
+	const SphereKey key{radius, stacks, slices};
+	auto it = spheres.find(key);
+	if (it != spheres.end())
+		return it->second;
+
+	const IndexedMesh m = generateIndexedSphere(radius, stacks, slices);
+	GpuMesh g;
+	g.indexCount = static_cast<GLsizei>(m.indices.size());
+	g.radius = radius;
+
+	glGenVertexArrays(1, &g.vao);
+	glGenBuffers(1, &g.vbo);
+	glGenBuffers(1, &g.ebo);
+	glBindVertexArray(g.vao);
+	glBindBuffer(GL_ARRAY_BUFFER, g.vbo);
+	glBufferData(GL_ARRAY_BUFFER, m.vertices.size() * sizeof(float), m.vertices.data(), GL_STATIC_DRAW);
+	glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 6 * sizeof(float), (void *)0);
+	glEnableVertexAttribArray(0);
+	glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, 6 * sizeof(float), (void *)(3 * sizeof(float)));
+	glEnableVertexAttribArray(1);
+
+	// O EBO fica registrado no VAO: basta ligar o VAO para desenhar.
+	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, g.ebo);
+	glBufferData(GL_ELEMENT_ARRAY_BUFFER, m.indices.size() * sizeof(m.indices[0]), m.indices.data(), GL_STATIC_DRAW);
+	glBindVertexArray(0);
+
+	return spheres.emplace(key, g).first->second;
+}
+
+void MeshCache::destroy()
+{
+	for (auto &kv : spheres)
+	{
+		GpuMesh &g = kv.second;
+		glDeleteBuffers(1, &g.ebo);
+		glDeleteBuffers(1, &g.vbo);
+		glDeleteVertexArrays(1, &g.vao);
+	}
+	spheres.clear();
+}
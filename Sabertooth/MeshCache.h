@@ -0,0 +1,37 @@
+#pragma once
+/*
+------------------------------------------------------------------------------
+ MeshCache.h  –  Malhas indexadas na GPU, compartilhadas por parâmetros
+------------------------------------------------------------------------------
+ Cada esfera pedida com os mesmos (raio, stacks, slices) devolve o mesmo
+ VAO/VBO/EBO: a malha é gerada e enviada uma única vez, na primeira vez em
+ que é pedida. Os buffers vivem até destroy() (chamar com o contexto ativo).
+------------------------------------------------------------------------------*/
+
+#include <GL/glew.h>
+#include <map>
+#include <tuple>
+
+/// Malha pronta para glDrawElements(GL_TRIANGLES, indexCount, GL_UNSIGNED_SHORT, 0).
+struct GpuMesh
+{
+	GLuint vao = 0;
+	GLuint vbo = 0;
+	GLuint ebo = 0;
+	GLsizei indexCount = 0;
+	float radius = 0.0f; ///< raio da esfera envolvente, no espaço do modelo
+};
+
+class MeshCache
+{
+public:
+	/// Esfera colorida (layout de generateIndexedSphere: x,y,z,r,g,b).
+	const GpuMesh &sphere(float radius, int stacks, int slices);
+
+	/// Libera todos os buffers.
+	void destroy();
+
+private:
+	using SphereKey = std::tuple<float, int, int>;
+	std::map<SphereKey, GpuMesh> spheres;
+};
@@ -0,0 +1,235 @@
+#include "PostProcess.h"
+#include <cmath>
+#include <iostream>
+/*
+------------------------------------------------------------------------------
+ PostProcess.cpp  –  Implementação dos passes em tela cheia
+------------------------------------------------------------------------------*/
+
+// ╔═══════════════════════════════════════════════════════════════════════════╗
+// ║                                  Shaders                                  ║
+// ╚═══════════════════════════════════════════════════════════════════════════╝
+
+/// Triângulo que cobre a tela: (0,0), (2,0), (0,2) em UV.
+static const char *kFullscreenVS = R"(
+        #version 440 core
+        out vec2 vUV;
+        void main() {
+            vUV = vec2((gl_VertexID << 1) & 2, gl_VertexID & 2);
+            gl_Position = vec4(vUV * 2.0 - 1.0, 0.0, 1.0);
+        }
+    )";
+
+/// Um passo do gaussiano separável; `texelStep` define a direção.
+static const char *kBlurFS = R"(
+        #version 440 core
+        in vec2 vUV;
+        out vec4 FragColor;
+        uniform sampler2D source;
+        uniform vec2 texelStep;
+        uniform int radius;
+        uniform float weights[33];
+        void main() {
+            vec4 c = texture(source, vUV) * weights[0];
+            for (int i = 1; i <= radius; ++i)
+                c += (texture(source, vUV + texelStep * i) +
+                      texture(source, vUV - texelStep * i)) * weights[i];
+            FragColor = c;
+        }
+    )";
+
+static const char *kCompositeFS = R"(
+        #version 440 core
+        in vec2 vUV;
+        out vec4 FragColor;
+        uniform sampler2D source;
+        uniform float intensity;
+        void main() {
+            FragColor = texture(source, vUV) * intensity;
+        }
+    )";
+
+// ╔═══════════════════════════════════════════════════════════════════════════╗
+// ║                                RenderTarget                               ║
+// ╚═══════════════════════════════════════════════════════════════════════════╝
+
+void RenderTarget::init(int w, int h, bool withDepth)
+{
+	width = w;
+	height = h;
+
+	glGenTextures(1, &color);
+	glBindTexture(GL_TEXTURE_2D, color);
+	glTexStorage2D(GL_TEXTURE_2D, 1, GL_RGBA8, w, h);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+
+	glGenFramebuffers(1, &fbo);
+	glBindFramebuffer(GL_FRAMEBUFFER, fbo);
+	glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, color, 0);
+	if (withDepth)
+	{
+		glGenRenderbuffers(1, &depth);
+		glBindRenderbuffer(GL_RENDERBUFFER, depth);
+		glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH_COMPONENT24, w, h);
+		glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER, depth);
+	}
+	if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE)
+		std::cerr << "[PostProcess] Framebuffer " << w << "x" << h << " incompleto\n";
+	glBindFramebuffer(GL_FRAMEBUFFER, 0);
+}
+
+void RenderTarget::destroy()
+{
+	glDeleteFramebuffers(1, &fbo);
+	glDeleteTextures(1, &color);
+	glDeleteRenderbuffers(1, &depth);
+	fbo = color = depth = 0;
+	width = height = 0;
+}
+
+void RenderTarget::bind() const
+{
+	glBindFramebuffer(GL_FRAMEBUFFER, fbo);
+	glViewport(0, 0, width, height);
+}
+
+// ╔═══════════════════════════════════════════════════════════════════════════╗
+// ║                                GaussianBlur                               ║
+// ╚═══════════════════════════════════════════════════════════════════════════╝
+
+void GaussianBlur::init(int width, int height, int downsample)
+{
+	if (downsample < 1)
+		downsample = 1;
+	const int w = (width + downsample - 1) / downsample;
+	const int h = (height + downsample - 1) / downsample;
+	ping.init(w, h);
+	pong.init(w, h);
+
+	shader = std::make_unique<Shader>(kFullscreenVS, kBlurFS);
+	const GLuint prog = shader->getProgramID();
+	uStep = glGetUniformLocation(prog, "texelStep");
+	uRadius = glGetUniformLocation(prog, "radius");
+	uWeights = glGetUniformLocation(prog, "weights");
+	shader->use();
+	glUniform1i(glGetUniformLocation(prog, "source"), 0);
+
+	glGenVertexArrays(1, &vao);
+}
+
+void GaussianBlur::destroy()
+{
+	glDeleteVertexArrays(1, &vao);
+	vao = 0;
+	ping.destroy();
+	pong.destroy();
+	shader.reset();
+	weightsRadius = -1;
+}
+
+GLuint GaussianBlur::apply(GLuint source, int radius)
+{
+	radius = (radius < 0) ? 0 : (radius > kMaxRadius ? kMaxRadius : radius);
+
+	// Estado que os passes alteram.
+	GLint prevFbo, viewport[4];
+	glGetIntegerv(GL_DRAW_FRAMEBUFFER_BINDING, &prevFbo);
+	glGetIntegerv(GL_VIEWPORT, viewport);
+	const GLboolean depth = glIsEnabled(GL_DEPTH_TEST);
+	const GLboolean blend = glIsEnabled(GL_BLEND);
+	glDisable(GL_DEPTH_TEST);
+	glDisable(GL_BLEND);
+
+	shader->use();
+	glBindVertexArray(vao);
+	glActiveTexture(GL_TEXTURE0);
+
+	// Pesos normalizados de metade do núcleo; só mudam junto com o raio.
+	if (radius != weightsRadius)
+	{
+		float w[kMaxRadius + 1] = {1.0f};
+		if (radius > 0)
+		{
+			const float sigma = radius / 2.0f;
+			float sum = 0.0f;
+			for (int i = 0; i <= radius; ++i)
+			{
+				w[i] = std::exp(-(i * i) / (2.0f * sigma * sigma));
+				sum += (i == 0) ? w[i] : 2.0f * w[i];
+			}
+			for (int i = 0; i <= radius; ++i)
+				w[i] /= sum;
+		}
+		glUniform1fv(uWeights, kMaxRadius + 1, w);
+		glUniform1i(uRadius, radius);
+		weightsRadius = radius;
+	}
+
+	// Horizontal: origem (qualquer resolução) → ping, já reduzida.
+	ping.bind();
+	glBindTexture(GL_TEXTURE_2D, source);
+	glUniform2f(uStep, 1.0f / ping.width, 0.0f);
+	glDrawArrays(GL_TRIANGLES, 0, 3);
+
+	// Vertical: ping → pong.
+	pong.bind();
+	glBindTexture(GL_TEXTURE_2D, ping.color);
+	glUniform2f(uStep, 0.0f, 1.0f / pong.height);
+	glDrawArrays(GL_TRIANGLES, 0, 3);
+
+	glBindFramebuffer(GL_FRAMEBUFFER, static_cast<GLuint>(prevFbo));
+	glViewport(viewport[0], viewport[1], viewport[2], viewport[3]);
+	if (depth)
+		glEnable(GL_DEPTH_TEST);
+	if (blend)
+		glEnable(GL_BLEND);
+	return pong.color;
+}
+
+// ╔═══════════════════════════════════════════════════════════════════════════╗
+// ║                                 Compositor                                ║
+// ╚═══════════════════════════════════════════════════════════════════════════╝
+
+void Compositor::init()
+{
+	shader = std::make_unique<Shader>(kFullscreenVS, kCompositeFS);
+	const GLuint prog = shader->getProgramID();
+	uIntensity = glGetUniformLocation(prog, "intensity");
+	shader->use();
+	glUniform1i(glGetUniformLocation(prog, "source"), 0);
+
+	glGenVertexArrays(1, &vao);
+}
+
+void Compositor::destroy()
+{
+	glDeleteVertexArrays(1, &vao);
+	vao = 0;
+	shader.reset();
+}
+
+void Compositor::add(GLuint texture, float intensity)
+{
+	const GLboolean depth = glIsEnabled(GL_DEPTH_TEST);
+	const GLboolean blend = glIsEnabled(GL_BLEND);
+	glDisable(GL_DEPTH_TEST);
+	glEnable(GL_BLEND);
+	glBlendFunc(GL_ONE, GL_ONE);
+
+	shader->use();
+	glUniform1f(uIntensity, intensity);
+	glBindVertexArray(vao);
+	glActiveTexture(GL_TEXTURE0);
+	glBindTexture(GL_TEXTURE_2D, texture);
+	glDrawArrays(GL_TRIANGLES, 0, 3);
+
+	// Volta ao blend de transparência usado pelo resto da cena.
+	glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+	if (!blend)
+		glDisable(GL_BLEND);
+	if (depth)
+		glEnable(GL_DEPTH_TEST);
+}
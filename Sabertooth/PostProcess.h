@@ -0,0 +1,78 @@
+#pragma once
+/*
+------------------------------------------------------------------------------
+ PostProcess.h  –  Alvos de renderização e pós-processamento em tela cheia
+------------------------------------------------------------------------------
+ • RenderTarget: framebuffer com uma textura de cor (e, opcionalmente, um
+   buffer de profundidade), para desenhar fora da tela e usar o resultado
+   como textura – ou no lugar da janela, no modo sem janela;
+ • GaussianBlur: desfoque gaussiano separável com "ping-pong" entre dois
+   RenderTargets (horizontal, depois vertical). Cada pixel lê 2·r + 1
+   amostras por passo em vez de (2·r + 1)² num núcleo 2D, e a resolução
+   reduzida (downsample) divide o custo de novo pelo quadrado do fator;
+ • Compositor: soma (blend aditivo) uma textura sobre o framebuffer atual –
+   ex.: o brilho desfocado da explosão sobre a cena.
+
+ Os passes desenham um triângulo que cobre a tela (gerado no vertex shader a
+ partir de gl_VertexID, sem VBO) e deixam o programa ativo trocado: quem
+ desenha depois deve chamar use() no seu shader.
+------------------------------------------------------------------------------*/
+
+#include <GL/glew.h>
+#include <memory>
+
+#include "Shader.h"
+
+/// Framebuffer com cor RGBA8 (filtro linear, bordas repetidas).
+struct RenderTarget
+{
+	GLuint fbo = 0;
+	GLuint color = 0;
+	GLuint depth = 0; ///< renderbuffer DEPTH_COMPONENT24, se pedido em init
+	int width = 0, height = 0;
+
+	void init(int w, int h, bool withDepth = false);
+	void destroy();
+
+	/// Liga o framebuffer e ajusta o viewport ao seu tamanho.
+	void bind() const;
+};
+
+class GaussianBlur
+{
+public:
+	static constexpr int kMaxRadius = 32; ///< limite do vetor de pesos no shader
+
+	/// @param width, height  resolução da imagem de origem
+	/// @param downsample     divisor da resolução dos passes (1 = cheia)
+	void init(int width, int height, int downsample);
+	void destroy();
+
+	/// Desfoca `source` (qualquer textura 2D) com raio `radius` em pixels da
+	/// resolução reduzida (σ = radius / 2, como gaussianBlurRGBA). Restaura
+	/// framebuffer, viewport, teste de profundidade e blend.
+	/// @return textura com o resultado, válida até a próxima chamada
+	GLuint apply(GLuint source, int radius);
+
+private:
+	std::unique_ptr<Shader> shader;
+	GLuint vao = 0; ///< vazio: os vértices vêm de gl_VertexID
+	RenderTarget ping, pong;
+	GLint uStep = -1, uRadius = -1, uWeights = -1;
+	int weightsRadius = -1; ///< raio dos pesos já enviados ao shader
+};
+
+class Compositor
+{
+public:
+	void init();
+	void destroy();
+
+	/// Soma `texture` × intensity ao framebuffer ligado (blend GL_ONE, GL_ONE).
+	void add(GLuint texture, float intensity);
+
+private:
+	std::unique_ptr<Shader> shader;
+	GLuint vao = 0;
+	GLint uIntensity = -1;
+};
@@ -0,0 +1,200 @@
+#include "Profiler.h"
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+/*
+------------------------------------------------------------------------------
+ Profiler.cpp  –  Implementação do medidor de tempos por etapa
+------------------------------------------------------------------------------*/
+
+// ╔═══════════════════════════════════════════════════════════════════════════╗
+// ║                               Estatísticas                                ║
+// ╚═══════════════════════════════════════════════════════════════════════════╝
+
+Profiler::Summary Profiler::Samples::summary() const
+{
+	Summary s;
+	s.samples = std::min(count, kHistory);
+	if (s.samples == 0)
+		return s;
+
+	std::array<float, kHistory> sorted = ms;
+	float *end = sorted.data() + s.samples;
+	std::sort(sorted.data(), end);
+
+	double sum = 0.0;
+	for (const float *v = sorted.data(); v != end; ++v)
+		sum += *v;
+	s.min = sorted[0];
+	s.avg = static_cast<float>(sum / s.samples);
+	s.p99 = sorted[static_cast<size_t>((s.samples - 1) * 0.99f + 0.5f)];
+	return s;
+}
+
+// ╔═══════════════════════════════════════════════════════════════════════════╗
+// ║                                 Profiler                                  ║
+// ╚═══════════════════════════════════════════════════════════════════════════╝
+
+Profiler::Profiler() : origin(Clock::now()) {}
+
+void Profiler::destroy()
+{
+	for (auto &slot : inFlight)
+	{
+		for (const PendingQuery &q : slot)
+			freeQueries.push_back(q.query);
+		slot.clear();
+	}
+	if (!freeQueries.empty())
+		glDeleteQueries(static_cast<GLsizei>(freeQueries.size()), freeQueries.data());
+	freeQueries.clear();
+}
+
+double Profiler::nowUs() const
+{
+	return std::chrono::duration<double, std::micro>(Clock::now() - origin).count();
+}
+
+int Profiler::findStage(const char *name) const
+{
+	for (size_t i = 0; i < stages.size(); ++i)
+		if (stages[i].name == name || std::strcmp(stages[i].name, name) == 0)
+			return static_cast<int>(i);
+	return -1;
+}
+
+int Profiler::stageIndex(const char *name)
+{
+	const int i = findStage(name);
+	if (i >= 0)
+		return i;
+	stages.push_back({name, {}, {}});
+	return static_cast<int>(stages.size() - 1);
+}
+
+void Profiler::trace(int stage, bool gpu, double startUs, double durUs)
+{
+	if (events.size() < kMaxTraceEvents)
+		events.push_back({stage, gpu, startUs, durUs});
+}
+
+void Profiler::addCpu(int stage, double startUs, double endUs)
+{
+	stages[stage].cpu.add(static_cast<float>((endUs - startUs) / 1000.0));
+	trace(stage, false, startUs, endUs - startUs);
+}
+
+void Profiler::beginFrame()
+{
+	frame = (frame + 1) % kLatency;
+
+	// Consultas emitidas kLatency quadros atrás: a GPU já deve tê-las
+	// terminado. Se ainda não, a amostra é descartada em vez de esperar.
+	for (const PendingQuery &q : inFlight[frame])
+	{
+		GLint available = GL_FALSE;
+		glGetQueryObjectiv(q.query, GL_QUERY_RESULT_AVAILABLE, &available);
+		if (available)
+		{
+			GLuint64 ns = 0;
+			glGetQueryObjectui64v(q.query, GL_QUERY_RESULT, &ns);
+			stages[q.stage].gpu.add(static_cast<float>(ns / 1.0e6));
+			trace(q.stage, true, q.startUs, ns / 1.0e3);
+		}
+		freeQueries.push_back(q.query);
+	}
+	inFlight[frame].clear();
+}
+
+bool Profiler::beginGpu(const char *name)
+{
+	if (gpuActive)
+		return false;
+
+	GLuint query = 0;
+	if (freeQueries.empty())
+		glGenQueries(1, &query);
+	else
+	{
+		query = freeQueries.back();
+		freeQueries.pop_back();
+	}
+
+	inFlight[frame].push_back({stageIndex(name), query, nowUs()});
+	glBeginQuery(GL_TIME_ELAPSED, query);
+	gpuActive = true;
+	return true;
+}
+
+void Profiler::endGpu()
+{
+	glEndQuery(GL_TIME_ELAPSED);
+	gpuActive = false;
+}
+
+Profiler::Summary Profiler::cpu(const char *stage) const
+{
+	const int i = findStage(stage);
+	return (i < 0) ? Summary{} : stages[i].cpu.summary();
+}
+
+Profiler::Summary Profiler::gpu(const char *stage) const
+{
+	const int i = findStage(stage);
+	return (i < 0) ? Summary{} : stages[i].gpu.summary();
+}
+
+void Profiler::report(std::ostream &out) const
+{
+	out << std::fixed << std::setprecision(3)
+			<< "Etapa          CPU min / média / p99 (ms)    GPU min / média / p99 (ms)\n";
+	for (const Stage &st : stages)
+	{
+		const Summary c = st.cpu.summary();
+		const Summary g = st.gpu.summary();
+		out << std::left << std::setw(14) << st.name << std::right << ' '
+				<< std::setw(8) << c.min << std::setw(8) << c.avg << std::setw(8) << c.p99 << "      ";
+		if (g.samples)
+			out << std::setw(8) << g.min << std::setw(8) << g.avg << std::setw(8) << g.p99;
+		else
+			out << "       -";
+		out << '\n';
+	}
+}
+
+bool Profiler::writeChromeTrace(const std::string &path) const
+{
+	std::ofstream out(path, std::ios::binary);
+	if (!out)
+		return false;
+
+	// Nomes das etapas são literais do programa: sem aspas nem barras.
+	out << std::fixed << std::setprecision(3) << "{\"traceEvents\":[\n";
+	out << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":1,\"args\":{\"name\":\"CPU\"}},\n";
+	out << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":2,\"args\":{\"name\":\"GPU\"}}";
+	for (const TraceEvent &e : events)
+		out << ",\n{\"name\":\"" << stages[e.stage].name << "\",\"cat\":\"" << (e.gpu ? "gpu" : "cpu")
+				<< "\",\"ph\":\"X\",\"pid\":1,\"tid\":" << (e.gpu ? 2 : 1)
+				<< ",\"ts\":" << e.startUs << ",\"dur\":" << e.durUs << '}';
+	out << "\n],\"displayTimeUnit\":\"ms\"}\n";
+	return static_cast<bool>(out);
+}
+
+// ╔═══════════════════════════════════════════════════════════════════════════╗
+// ║                                  Escopos                                  ║
+// ╚═══════════════════════════════════════════════════════════════════════════╝
+
+CpuScope::CpuScope(Profiler &p, const char *name)
+		: profiler(p), stage(p.stageIndex(name)), startUs(p.nowUs()) {}
+
+CpuScope::~CpuScope() { profiler.addCpu(stage, startUs, profiler.nowUs()); }
+
+GpuScope::GpuScope(Profiler &p, const char *name)
+		: profiler(p), cpu(p, name), active(p.beginGpu(name)) {}
+
+GpuScope::~GpuScope()
+{
+	if (active)
+		profiler.endGpu();
+}
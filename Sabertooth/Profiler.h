@@ -0,0 +1,151 @@
+#pragma once
+/*
+------------------------------------------------------------------------------
+ Profiler.h  –  Tempos por etapa do quadro (CPU e GPU)
+------------------------------------------------------------------------------
+ • CpuScope: mede com steady_clock do construtor ao destrutor;
+ • GpuScope: envolve os comandos GL emitidos no escopo num par
+   glBeginQuery/glEndQuery(GL_TIME_ELAPSED). O resultado só é lido kLatency
+   quadros depois, quando a GPU já terminou – ler antes travaria a CPU à
+   espera dela. Consultas GL_TIME_ELAPSED não podem ser aninhadas: um
+   GpuScope dentro de outro é ignorado.
+
+ Cada etapa (identificada pelo nome, uma string literal) guarda as últimas
+ kHistory amostras de CPU e de GPU, resumidas em mínimo, média e p99.
+ Todos os escopos também viram eventos de um trace no formato "Trace Event"
+ do Chrome (chrome://tracing ou ui.perfetto.dev): a CPU na thread 1, a GPU
+ na thread 2 – posicionada no instante em que a CPU emitiu os comandos, já
+ que GL_TIME_ELAPSED só mede a duração.
+
+ Uso (só na thread do contexto GL):
+     profiler.beginFrame();
+     { CpuScope s(profiler, "input"); ... }
+     { GpuScope g(profiler, "scene"); ... }
+------------------------------------------------------------------------------*/
+
+#include <GL/glew.h>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+class Profiler
+{
+public:
+	static constexpr int kHistory = 240;		 ///< amostras por etapa (~4 s a 60 Hz)
+	static constexpr int kLatency = 3;			 ///< quadros até ler uma consulta GPU
+	static constexpr size_t kMaxTraceEvents = 200000; ///< depois disso o trace para de crescer
+
+	/// Mínimo, média e p99 (ms) das amostras guardadas.
+	struct Summary
+	{
+		float min = 0.0f, avg = 0.0f, p99 = 0.0f;
+		int samples = 0;
+	};
+
+	Profiler();
+
+	/// Libera as consultas GL (chamar com o contexto ativo).
+	void destroy();
+
+	/// Início do quadro: recolhe os resultados GPU de kLatency quadros atrás.
+	void beginFrame();
+
+	[[nodiscard]] Summary cpu(const char *stage) const;
+	[[nodiscard]] Summary gpu(const char *stage) const;
+
+	/// Tabela com todas as etapas, na ordem em que apareceram.
+	void report(std::ostream &out) const;
+
+	/// Grava o trace (JSON "Trace Event" do Chrome).
+	bool writeChromeTrace(const std::string &path) const;
+
+private:
+	friend class CpuScope;
+	friend class GpuScope;
+
+	using Clock = std::chrono::steady_clock;
+
+	/// Últimas kHistory amostras de uma medida (anel).
+	struct Samples
+	{
+		std::array<float, kHistory> ms{};
+		int count = 0; ///< total já recebido (o anel guarda até kHistory)
+		void add(float v) { ms[count++ % kHistory] = v; }
+		[[nodiscard]] Summary summary() const;
+	};
+
+	struct Stage
+	{
+		const char *name;
+		Samples cpu, gpu;
+	};
+
+	struct TraceEvent
+	{
+		int stage;
+		bool gpu;
+		double startUs, durUs;
+	};
+
+	/// Consulta GPU emitida e ainda não lida.
+	struct PendingQuery
+	{
+		int stage;
+		GLuint query;
+		double startUs; ///< instante CPU do glBeginQuery
+	};
+
+	int stageIndex(const char *name);
+	[[nodiscard]] int findStage(const char *name) const;
+	[[nodiscard]] double nowUs() const;
+	void addCpu(int stage, double startUs, double endUs);
+	void trace(int stage, bool gpu, double startUs, double durUs);
+
+	/// Início de um GpuScope: false se já houver outra consulta ativa.
+	bool beginGpu(const char *name);
+	void endGpu();
+
+	Clock::time_point origin;
+	std::vector<Stage> stages;
+	std::vector<TraceEvent> events;
+
+	std::array<std::vector<PendingQuery>, kLatency> inFlight; ///< por quadro
+	std::vector<GLuint> freeQueries;
+	int frame = 0;
+	bool gpuActive = false;
+};
+
+/// Mede o tempo de CPU do escopo como a etapa `name`.
+class CpuScope
+{
+public:
+	CpuScope(Profiler &p, const char *name);
+	~CpuScope();
+
+	CpuScope(const CpuScope &) = delete;
+	CpuScope &operator=(const CpuScope &) = delete;
+
+private:
+	Profiler &profiler;
+	int stage;
+	double startUs;
+};
+
+/// Mede o tempo de GPU dos comandos emitidos no escopo (e também o de CPU).
+class GpuScope
+{
+public:
+	GpuScope(Profiler &p, const char *name);
+	~GpuScope();
+
+	GpuScope(const GpuScope &) = delete;
+	GpuScope &operator=(const GpuScope &) = delete;
+
+private:
+	Profiler &profiler;
+	CpuScope cpu;
+	bool active;
+};
@@ -0,0 +1,92 @@
+#include "RenderQueue.h"
+#include "Logger.h"
+#include <algorithm>
+/*
+------------------------------------------------------------------------------
+ RenderQueue.cpp  –  Implementação da fila de comandos de desenho
+------------------------------------------------------------------------------*/
+
+std::uint64_t RenderQueue::sortKey(const DrawCommand &cmd)
+{
+	const float d = (cmd.depth < 0.0f) ? 0.0f : (cmd.depth > 1.0f ? 1.0f : cmd.depth);
+	const auto depth = static_cast<std::uint64_t>(d * 65535.0f);
+
+	return (static_cast<std::uint64_t>(cmd.layer) & 0x3u) << 62 |
+				 (static_cast<std::uint64_t>(cmd.program) & 0x3FFFu) << 48 |
+				 (static_cast<std::uint64_t>(cmd.vao) & 0x3FFFu) << 34 |
+				 (static_cast<std::uint64_t>(cmd.texture) & 0xFFFFu) << 18 |
+				 (depth & 0xFFFFu) << 2;
+}
+
+void RenderQueue::submit(const DrawCommand &cmd)
+{
+	order.push_back({sortKey(cmd), static_cast<std::uint32_t>(commands.size())});
+	commands.push_back(cmd);
+}
+
+void RenderQueue::flush(UniformRing &objects)
+{
+	// Estável: comandos de mesma chave mantêm a ordem de envio.
+	std::stable_sort(order.begin(), order.end(),
+									 [](const Entry &a, const Entry &b)
+									 { return a.key < b.key; });
+
+	last = Stats{};
+	GLuint program = 0, vao = 0;
+	GLuint bound[2] = {0, 0}; ///< textura ligada nas unidades 0 e 1 (as que a cena usa)
+	bool first = true;				///< o estado GL antes do flush é desconhecido
+
+	for (const Entry &e : order)
+	{
+		const DrawCommand &cmd = commands[e.index];
+
+		if (first || cmd.program != program)
+		{
+			glUseProgram(cmd.program);
+			program = cmd.program;
+			++last.programBinds;
+		}
+		if (first || cmd.vao != vao)
+		{
+			glBindVertexArray(cmd.vao);
+			vao = cmd.vao;
+			++last.vaoBinds;
+		}
+		if (cmd.texture != 0)
+		{
+			const bool tracked = cmd.textureUnit < 2;
+			if (!tracked || bound[cmd.textureUnit] != cmd.texture)
+			{
+				glActiveTexture(GL_TEXTURE0 + cmd.textureUnit);
+				glBindTexture(cmd.textureTarget, cmd.texture);
+				if (tracked)
+					bound[cmd.textureUnit] = cmd.texture;
+				++last.textureBinds;
+			}
+		}
+		first = false;
+
+		if (!objects.push(cmd.object))
+		{
+			++last.skipped; // sem espaço no StreamBuffer: pula em vez de usar dados de outro objeto
+			continue;
+		}
+
+		if (cmd.indexType)
+			glDrawElementsInstancedBaseInstance(cmd.mode, cmd.count, cmd.indexType, nullptr,
+																					cmd.instances, cmd.baseInstance);
+		else
+			glDrawArraysInstancedBaseInstance(cmd.mode, 0, cmd.count, cmd.instances, cmd.baseInstance);
+		++last.draws;
+	}
+	glActiveTexture(GL_TEXTURE0);
+	if (last.skipped > 0)
+	{
+		static LogRate rate(1.0f); // repetiria a cada quadro
+		Logger::get().write(rate, LogLevel::Warn, "[RenderQueue] StreamBuffer cheio: %d de %zu desenhos pulados",
+												last.skipped, commands.size());
+	}
+
+	commands.clear();
+	order.clear();
+}
@@ -0,0 +1,87 @@
+#pragma once
+/*
+------------------------------------------------------------------------------
+ RenderQueue.h  –  Fila de comandos de desenho ordenada por estado
+------------------------------------------------------------------------------
+ As funções de desenho não chamam o GL na hora: registram um DrawCommand
+ (programa, VAO, textura, dados do bloco Object e a chamada em si) com uma
+ chave de ordenação de 64 bits. flush() ordena pela chave e executa,
+ trocando programa, VAO e textura só quando mudam – o número de trocas de
+ estado passa a depender de quantos estados distintos existem, não de
+ quantas entidades são desenhadas.
+
+ Chave, do bit mais significativo ao menos:
+     camada (2) | programa (14) | VAO (14) | textura (16) | profundidade (16)
+ A camada vem primeiro para que o fundo seja sempre desenhado antes do
+ resto; a profundidade só desempata (de frente para trás, o que poupa
+ fragmentos com o teste de profundidade). Nomes GL maiores que o campo só
+ pioram o agrupamento: a execução compara o estado real, não a chave.
+------------------------------------------------------------------------------*/
+
+#include <GL/glew.h>
+#include <cstdint>
+#include <vector>
+
+#include "UniformBuffers.h"
+
+/// Ordem de desenho entre grupos, acima de qualquer estado.
+enum class RenderLayer : std::uint8_t
+{
+	Background = 0, ///< fundo: sempre antes
+	Scene = 1				///< prédios, jogadores, projétil, explosão
+};
+
+struct DrawCommand
+{
+	RenderLayer layer = RenderLayer::Scene;
+	GLuint program = 0;
+	GLuint vao = 0;
+	GLenum textureTarget = GL_TEXTURE_2D;
+	GLuint texture = 0; ///< 0 = não liga textura
+	GLuint textureUnit = 0;
+	float depth = 0.5f; ///< 0 = perto, 1 = longe (desempate)
+
+	ObjectUniforms object; ///< bloco Object deste desenho
+
+	GLenum mode = GL_TRIANGLES;
+	GLsizei count = 0;				 ///< vértices ou índices
+	GLenum indexType = 0;			 ///< 0 = glDrawArrays; senão tipo dos índices
+	GLsizei instances = 1;
+	GLuint baseInstance = 0;
+};
+
+class RenderQueue
+{
+public:
+	/// Trocas de estado e desenhos do último flush().
+	struct Stats
+	{
+		int draws = 0;
+		int programBinds = 0;
+		int vaoBinds = 0;
+		int textureBinds = 0;
+		int skipped = 0; ///< desenhos descartados: bloco Object sem espaço no StreamBuffer
+	};
+
+	/// Registra um desenho para o próximo flush().
+	void submit(const DrawCommand &cmd);
+
+	/// Ordena, executa e esvazia a fila. Os blocos Object vão para
+	/// `objects`; o programa e o VAO ativos ao final ficam indefinidos.
+	void flush(UniformRing &objects);
+
+	[[nodiscard]] const Stats &stats() const { return last; }
+
+private:
+	struct Entry
+	{
+		std::uint64_t key;
+		std::uint32_t index; ///< posição em commands
+	};
+
+	static std::uint64_t sortKey(const DrawCommand &cmd);
+
+	std::vector<DrawCommand> commands;
+	std::vector<Entry> order; ///< ordenado em flush(); reaproveita a memória
+	Stats last;
+};
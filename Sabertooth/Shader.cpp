@@ -1,10 +1,29 @@
 ﻿#include "Shader.h"
-#include <iostream>
+#include "Logger.h"
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <vector>
 /*
 ------------------------------------------------------------------------------
  Shader.cpp  –  Implementação da classe utilitária de shader.
 ------------------------------------------------------------------------------*/
 
+std::string Shader::cacheDir;
+bool Shader::parallelCompile = false;
+
+/// Conteúdo inteiro de um arquivo de texto.
+static bool readFile(const std::string &path, std::string &out)
+{
+	std::ifstream in(path, std::ios::binary);
+	if (!in)
+		return false;
+	out.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+	return true;
+}
+
 Shader::Shader(const char *vs, const char *fs)
 {
 	programID = createShaderProgram(vs, fs);
@@ -12,19 +31,159 @@ Shader::Shader(const char *vs, const char *fs)
 
 Shader::~Shader()
 {
+	discardPending();
 	glDeleteProgram(programID);
 }
 
+std::unique_ptr<Shader> Shader::fromFiles(const std::string &vertexPath, const std::string &fragmentPath)
+{
+	std::string vs, fs;
+	if (!readFile(vertexPath, vs))
+		logError("[Shader] Não foi possível ler %s", vertexPath.c_str());
+	if (!readFile(fragmentPath, fs))
+		logError("[Shader] Não foi possível ler %s", fragmentPath.c_str());
+
+	auto shader = std::make_unique<Shader>(vs.c_str(), fs.c_str());
+	shader->vertexPath = vertexPath;
+	shader->fragmentPath = fragmentPath;
+	return shader;
+}
+
 void Shader::use() { glUseProgram(programID); }
 
 GLuint Shader::getProgramID() const { return programID; }
 
+bool Shader::bindBlock(const char *name, GLuint binding)
+{
+	const GLuint index = glGetUniformBlockIndex(programID, name);
+	if (index == GL_INVALID_INDEX)
+		return false;
+	glUniformBlockBinding(programID, index, binding);
+	return true;
+}
+
+void Shader::setBinaryCacheDir(const std::string &dir) { cacheDir = dir; }
+
+bool Shader::uses(const std::string &path) const
+{
+	return !path.empty() && (path == vertexPath || path == fragmentPath);
+}
+
+// ╔═══════════════════════════════════════════════════════════════════════════╗
+// ║                          Recarga em Tempo de Execução                     ║
+// ╚═══════════════════════════════════════════════════════════════════════════╝
+
+void Shader::reload()
+{
+	std::string vs, fs;
+	if (vertexPath.empty() || !readFile(vertexPath, vs) || !readFile(fragmentPath, fs))
+		return; // arquivo no meio de uma gravação: o próximo aviso tenta de novo
+
+	// Uma vez por execução: deixa o driver usar quantas threads quiser.
+	static bool threadsSet = false;
+	if (!threadsSet)
+	{
+		threadsSet = true;
+		if (GLEW_KHR_parallel_shader_compile)
+		{
+			glMaxShaderCompilerThreadsKHR(0xFFFFFFFFu);
+			parallelCompile = true;
+		}
+		else if (GLEW_ARB_parallel_shader_compile)
+		{
+			glMaxShaderCompilerThreadsARB(0xFFFFFFFFu);
+			parallelCompile = true;
+		}
+	}
+
+	// Uma edição nova substitui a compilação anterior ainda não concluída.
+	discardPending();
+
+	const char *src[2] = {vs.c_str(), fs.c_str()};
+	pending.vert = glCreateShader(GL_VERTEX_SHADER);
+	pending.frag = glCreateShader(GL_FRAGMENT_SHADER);
+	glShaderSource(pending.vert, 1, &src[0], nullptr);
+	glShaderSource(pending.frag, 1, &src[1], nullptr);
+	glCompileShader(pending.vert);
+	glCompileShader(pending.frag);
+
+	// Sem consultar status aqui: com a extensão, essas chamadas retornam
+	// imediatamente e o trabalho segue nas threads do driver.
+	pending.prog = glCreateProgram();
+	glAttachShader(pending.prog, pending.vert);
+	glAttachShader(pending.prog, pending.frag);
+	GLint formats = 0;
+	glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formats);
+	if (!cacheDir.empty() && formats > 0)
+	{
+		pending.key = cacheKey(src[0], src[1]);
+		glProgramParameteri(pending.prog, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+	}
+	glLinkProgram(pending.prog);
+}
+
+bool Shader::update()
+{
+	if (!pending.prog)
+		return false;
+
+	if (parallelCompile)
+	{
+		GLint done = GL_FALSE;
+		glGetProgramiv(pending.prog, GL_COMPLETION_STATUS_KHR, &done);
+		if (!done)
+			return false; // tenta de novo no próximo quadro
+	}
+
+	GLint linked = GL_FALSE;
+	glGetProgramiv(pending.prog, GL_LINK_STATUS, &linked);
+	if (!linked)
+	{
+		checkCompileErrors(pending.vert, "VERTEX");
+		checkCompileErrors(pending.frag, "FRAGMENT");
+		checkCompileErrors(pending.prog, "PROGRAM");
+		logWarn("[Shader] Mantendo o programa anterior de %s + %s", vertexPath.c_str(), fragmentPath.c_str());
+		discardPending();
+		return false;
+	}
+
+	// Troca: o programa novo só entra em uso já linkado.
+	glDeleteProgram(programID);
+	programID = pending.prog;
+	if (pending.key)
+		saveBinary(programID, pending.key);
+	pending.prog = 0;
+	discardPending(); // solta os objetos de shader
+	logInfo("[Shader] Recarregado: %s + %s", vertexPath.c_str(), fragmentPath.c_str());
+	return true;
+}
+
+void Shader::discardPending()
+{
+	if (pending.vert)
+		glDeleteShader(pending.vert);
+	if (pending.frag)
+		glDeleteShader(pending.frag);
+	if (pending.prog)
+		glDeleteProgram(pending.prog);
+	pending = Pending{};
+}
+
 // ╔═══════════════════════════════════════════════════════════════════════════╗
 // ║                    Funções Estáticas de Implementação                     ║
 // ╚═══════════════════════════════════════════════════════════════════════════╝
 
 GLuint Shader::createShaderProgram(const char *vs, const char *fs)
 {
+	// Driver sem formatos de binário: o cache não tem o que guardar.
+	GLint formats = 0;
+	glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formats);
+	const bool cached = !cacheDir.empty() && formats > 0;
+	const std::uint64_t key = cached ? cacheKey(vs, fs) : 0;
+	if (cached)
+		if (GLuint prog = loadBinary(key))
+			return prog;
+
 	auto compile = [&](GLenum type, const char *src)
 	{
 		GLuint id = glCreateShader(type);
@@ -40,14 +199,115 @@ GLuint Shader::createShaderProgram(const char *vs, const char *fs)
 	GLuint prog = glCreateProgram();
 	glAttachShader(prog, vert);
 	glAttachShader(prog, frag);
+	if (cached)
+		glProgramParameteri(prog, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
 	glLinkProgram(prog);
 	checkCompileErrors(prog, "PROGRAM");
 
 	glDeleteShader(vert);
 	glDeleteShader(frag);
+
+	GLint linked = GL_FALSE;
+	glGetProgramiv(prog, GL_LINK_STATUS, &linked);
+	if (cached && linked)
+		saveBinary(prog, key);
+	return prog;
+}
+
+// ╔═══════════════════════════════════════════════════════════════════════════╗
+// ║                      Cache de Binários de Programa                        ║
+// ╚═══════════════════════════════════════════════════════════════════════════╝
+
+namespace
+{
+	constexpr char kBinaryMagic[4] = {'G', 'S', 'P', 'B'};
+	constexpr std::uint32_t kBinaryVersion = 1;
+
+	/// Cabeçalho do arquivo; o binário do driver vem logo depois.
+	struct BinaryHeader
+	{
+		char magic[4];
+		std::uint32_t version;
+		std::uint64_t key;		///< repete o nome do arquivo (detecta colisão/cópia)
+		std::uint32_t format; ///< binaryFormat devolvido por glGetProgramBinary
+		std::uint32_t length; ///< bytes do binário
+	};
+
+	std::string binaryPath(const std::string &dir, std::uint64_t key)
+	{
+		char name[32];
+		std::snprintf(name, sizeof name, "%016llx.bin", static_cast<unsigned long long>(key));
+		return (std::filesystem::path(dir) / name).string();
+	}
+}
+
+std::uint64_t Shader::cacheKey(const char *vs, const char *fs)
+{
+	std::uint64_t h = 1469598103934665603ull;
+	auto mix = [&](const char *str)
+	{
+		for (const char *c = str ? str : ""; *c; ++c)
+			h = (h ^ static_cast<unsigned char>(*c)) * 1099511628211ull;
+		h = (h ^ 0xFFu) * 1099511628211ull; // separador entre campos
+	};
+	mix(vs);
+	mix(fs);
+	// Um driver novo pode mudar o formato do binário: entra na chave.
+	mix(reinterpret_cast<const char *>(glGetString(GL_VENDOR)));
+	mix(reinterpret_cast<const char *>(glGetString(GL_RENDERER)));
+	mix(reinterpret_cast<const char *>(glGetString(GL_VERSION)));
+	return h;
+}
+
+GLuint Shader::loadBinary(std::uint64_t key)
+{
+	std::ifstream in(binaryPath(cacheDir, key), std::ios::binary);
+	BinaryHeader h;
+	if (!in || !in.read(reinterpret_cast<char *>(&h), sizeof h) ||
+			std::memcmp(h.magic, kBinaryMagic, 4) != 0 || h.version != kBinaryVersion ||
+			h.key != key || h.length == 0)
+		return 0;
+
+	std::vector<char> blob(h.length);
+	if (!in.read(blob.data(), static_cast<std::streamsize>(blob.size())))
+		return 0;
+
+	// O driver pode recusar (atualização, outra GPU): aí compilamos de novo.
+	GLuint prog = glCreateProgram();
+	glProgramBinary(prog, static_cast<GLenum>(h.format), blob.data(), static_cast<GLsizei>(h.length));
+	GLint linked = GL_FALSE;
+	glGetProgramiv(prog, GL_LINK_STATUS, &linked);
+	if (!linked)
+	{
+		glDeleteProgram(prog);
+		return 0;
+	}
 	return prog;
 }
 
+void Shader::saveBinary(GLuint prog, std::uint64_t key)
+{
+	GLint length = 0;
+	glGetProgramiv(prog, GL_PROGRAM_BINARY_LENGTH, &length);
+	if (length <= 0)
+		return;
+
+	std::vector<char> blob(static_cast<size_t>(length));
+	GLenum format = 0;
+	glGetProgramBinary(prog, length, &length, &format, blob.data());
+
+	std::error_code ec;
+	std::filesystem::create_directories(cacheDir, ec);
+	std::ofstream out(binaryPath(cacheDir, key), std::ios::binary);
+	if (!out)
+		return; // sem cache nesta execução; o programa já está pronto
+
+	BinaryHeader h{{kBinaryMagic[0], kBinaryMagic[1], kBinaryMagic[2], kBinaryMagic[3]},
+								 kBinaryVersion, key, format, static_cast<std::uint32_t>(length)};
+	out.write(reinterpret_cast<const char *>(&h), sizeof h);
+	out.write(blob.data(), length);
+}
+
 void Shader::checkCompileErrors(GLuint object, const std::string &stage)
 {
 	GLint ok;
@@ -58,8 +318,8 @@ void Shader::checkCompileErrors(GLuint object, const std::string &stage)
 		{
 			char log[1024];
 			glGetShaderInfoLog(object, 1024, nullptr, log);
-			std::cerr << "[Shader] Erro de compilação (" << stage << ")\n"
-								<< log << "\n";
+			logError("[Shader] Erro de compilação (%s)", stage.c_str());
+			Logger::get().writeLines(LogLevel::Error, "[Shader]   ", log);
 		}
 	}
 	else
@@ -69,8 +329,8 @@ void Shader::checkCompileErrors(GLuint object, const std::string &stage)
 		{
 			char log[1024];
 			glGetProgramInfoLog(object, 1024, nullptr, log);
-			std::cerr << "[Shader] Erro de linkagem\n"
-								<< log << "\n";
+			logError("[Shader] Erro de linkagem");
+			Logger::get().writeLines(LogLevel::Error, "[Shader]   ", log);
 		}
 	}
 }
\ No newline at end of file
@@ -5,6 +5,8 @@
 ------------------------------------------------------------------------------*/
 
 #include <GL/glew.h>
+#include <cstdint>
+#include <memory>
 #include <string>
 
 class Shader
@@ -13,18 +15,74 @@ public:
 	Shader(const char *vertexSrc, const char *fragmentSrc);
 	~Shader();
 
+	Shader(const Shader &) = delete;
+	Shader &operator=(const Shader &) = delete;
+
+	/// Cria o programa a partir de arquivos GLSL; reload() os rel depois.
+	static std::unique_ptr<Shader> fromFiles(const std::string &vertexPath,
+																					 const std::string &fragmentPath);
+
 	/// Ativa (glUseProgram) este programa.
 	void use();
 
 	/// Acesso ao ID bruto til para definir uniforms.
 	[[nodiscard]] GLuint getProgramID() const;
 
+	/// Liga o bloco uniform `name` ao ponto de ligao `binding` (o mesmo de
+	/// glBindBufferBase/Range). Como os uniforms, refazer aps update().
+	/// @return false se o programa no declara (ou no usa) o bloco
+	bool bindBlock(const char *name, GLuint binding);
+
+	/// Ativa o cache de binrios de programa em `dir` (vazio desativa).
+	/// Cada programa linkado  gravado com glGetProgramBinary; nas prximas
+	/// execues, glProgramBinary o recupera sem compilar o GLSL. A chave 
+	/// um hash dos fontes + fabricante/renderizador/verso do driver, e
+	/// qualquer falha ao carregar volta  compilao normal.
+	static void setBinaryCacheDir(const std::string &dir);
+
+	/// Verdadeiro se `path`  um dos arquivos de origem deste programa.
+	[[nodiscard]] bool uses(const std::string &path) const;
+
+	/// Rel os arquivos e comea a compilar em segundo plano (com
+	/// KHR/ARB_parallel_shader_compile; sem a extenso o driver compila na
+	/// hora). O programa atual continua em uso at update() troc-lo.
+	void reload();
+
+	/// Chamar uma vez por quadro. Se a recompilao terminou e linkou, troca
+	/// o programa e retorna true: quem chama deve reconsultar os uniforms e
+	/// reenviar seus valores. Se falhou, mostra o log e mantm o anterior.
+	bool update();
+
 private:
 	GLuint programID{0};
 
-	/// Cria, compila e linka o programa.
+	std::string vertexPath, fragmentPath; ///< vazios se criado de strings
+
+	/// Recompilao em andamento (prog == 0 se nenhuma).
+	struct Pending
+	{
+		GLuint vert = 0, frag = 0, prog = 0;
+		std::uint64_t key = 0; ///< chave do cache de binrios (0 = sem cache)
+	} pending;
+
+	void discardPending();
+
+	static bool parallelCompile; ///< KHR/ARB_parallel_shader_compile ativo
+
+	static std::string cacheDir; ///< vazio = cache desativado
+
+	/// Cria, compila e linka o programa (ou o l do cache de binrios).
 	static GLuint createShaderProgram(const char *vs, const char *fs);
 
+	/// Hash FNV-1a 64 bits dos fontes e da identificao do driver.
+	static std::uint64_t cacheKey(const char *vs, const char *fs);
+
+	/// Programa lido do cache, ou 0 se ausente, corrompido ou recusado.
+	static GLuint loadBinary(std::uint64_t key);
+
+	/// Grava o binrio de um programa j linkado.
+	static void saveBinary(GLuint prog, std::uint64_t key);
+
 	/// Verifica e mostra logs de erro (compilao ou linkagem).
 	static void checkCompileErrors(GLuint shader, const std::string &stage);
 };
\ No newline at end of file
@@ -0,0 +1,294 @@
+#include "ShotBatch.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+/*
+------------------------------------------------------------------------------
+ ShotBatch.cpp  –  Implementação da avaliação em lote (AVX / SSE2 / escalar)
+------------------------------------------------------------------------------
+ O lote é processado em blocos que cabem no cache, com os disparos em
+ estrutura de arrays (SoA: vx[], vy[], tExit[], tPlayer[]):
+   1. velocidades, pela mesma makeTrajectory do jogo;
+   2. saída da arena e oponente, vetorizados entre disparos: cada pista
+      SIMD é um disparo (4 doubles com AVX, 2 com SSE2). Os ramos de
+      arenaExitTime / sweepAABB viram seleções por máscara e o que é comum
+      a todos (ponto de partida, caixa do oponente, gravidade) sai do laço;
+   3. prédios pela grade, disparo a disparo (consulta irregular), só até o
+      primeiro dos eventos da fase 2.
+ A fase 2 faz as contas de Ballistics.cpp na mesma ordem e em double (a
+ raiz quadrada SIMD também é a IEEE), então cada disparo sai idêntico ao
+ de resolveShot – ShotBatchTest confere contra planShot.
+------------------------------------------------------------------------------*/
+
+#if defined(__AVX__)
+#include <immintrin.h>
+#define GORILLA_SIMD_AVX 1
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define GORILLA_SIMD_SSE2 1
+#endif
+
+// ╔═══════════════════════════════════════════════════════════════════════════╗
+// ║                              Pistas SIMD                                  ║
+// ╚═══════════════════════════════════════════════════════════════════════════╝
+
+namespace
+{
+	constexpr double INF = std::numeric_limits<double>::infinity();
+
+	// Operações usadas pelos kernels, em double (restante do bloco ou sem
+	// SIMD) e em Lanes (kLanes disparos por instrução). Máscara = resultado
+	// de uma comparação; sel(m, a, b) = m ? a : b pista a pista.
+	inline double root(double x) { return std::sqrt(x); }
+	inline double sel(bool m, double a, double b) { return m ? a : b; }
+
+#if defined(GORILLA_SIMD_AVX)
+	constexpr std::size_t kLanes = 4;
+
+	struct Mask
+	{
+		__m256d m;
+	};
+	struct Lanes
+	{
+		__m256d v;
+		Lanes(__m256d x) : v(x) {}
+		Lanes(double x) : v(_mm256_set1_pd(x)) {}
+	};
+
+	inline Lanes load(const float *p) { return _mm256_cvtps_pd(_mm_loadu_ps(p)); }
+	inline void store(float *p, const Lanes &a) { _mm_storeu_ps(p, _mm256_cvtpd_ps(a.v)); }
+
+	inline Lanes operator+(const Lanes &a, const Lanes &b) { return _mm256_add_pd(a.v, b.v); }
+	inline Lanes operator-(const Lanes &a, const Lanes &b) { return _mm256_sub_pd(a.v, b.v); }
+	inline Lanes operator*(const Lanes &a, const Lanes &b) { return _mm256_mul_pd(a.v, b.v); }
+	inline Lanes operator/(const Lanes &a, const Lanes &b) { return _mm256_div_pd(a.v, b.v); }
+	inline Lanes root(const Lanes &a) { return _mm256_sqrt_pd(a.v); }
+
+	inline Mask operator<(const Lanes &a, const Lanes &b) { return {_mm256_cmp_pd(a.v, b.v, _CMP_LT_OQ)}; }
+	inline Mask operator<=(const Lanes &a, const Lanes &b) { return {_mm256_cmp_pd(a.v, b.v, _CMP_LE_OQ)}; }
+	inline Mask operator>(const Lanes &a, const Lanes &b) { return {_mm256_cmp_pd(a.v, b.v, _CMP_GT_OQ)}; }
+	inline Mask operator>=(const Lanes &a, const Lanes &b) { return {_mm256_cmp_pd(a.v, b.v, _CMP_GE_OQ)}; }
+	inline Mask operator==(const Lanes &a, const Lanes &b) { return {_mm256_cmp_pd(a.v, b.v, _CMP_EQ_OQ)}; }
+	inline Mask operator&(const Mask &a, const Mask &b) { return {_mm256_and_pd(a.m, b.m)}; }
+	inline Mask operator|(const Mask &a, const Mask &b) { return {_mm256_or_pd(a.m, b.m)}; }
+	inline Lanes sel(const Mask &m, const Lanes &a, const Lanes &b) { return _mm256_blendv_pd(b.v, a.v, m.m); }
+#elif defined(GORILLA_SIMD_SSE2)
+	constexpr std::size_t kLanes = 2;
+
+	struct Mask
+	{
+		__m128d m;
+	};
+	struct Lanes
+	{
+		__m128d v;
+		Lanes(__m128d x) : v(x) {}
+		Lanes(double x) : v(_mm_set1_pd(x)) {}
+	};
+
+	inline Lanes load(const float *p)
+	{
+		return _mm_cvtps_pd(_mm_castsi128_ps(_mm_loadl_epi64(reinterpret_cast<const __m128i *>(p))));
+	}
+	inline void store(float *p, const Lanes &a)
+	{
+		_mm_storel_epi64(reinterpret_cast<__m128i *>(p), _mm_castps_si128(_mm_cvtpd_ps(a.v)));
+	}
+
+	inline Lanes operator+(const Lanes &a, const Lanes &b) { return _mm_add_pd(a.v, b.v); }
+	inline Lanes operator-(const Lanes &a, const Lanes &b) { return _mm_sub_pd(a.v, b.v); }
+	inline Lanes operator*(const Lanes &a, const Lanes &b) { return _mm_mul_pd(a.v, b.v); }
+	inline Lanes operator/(const Lanes &a, const Lanes &b) { return _mm_div_pd(a.v, b.v); }
+	inline Lanes root(const Lanes &a) { return _mm_sqrt_pd(a.v); }
+
+	inline Mask operator<(const Lanes &a, const Lanes &b) { return {_mm_cmplt_pd(a.v, b.v)}; }
+	inline Mask operator<=(const Lanes &a, const Lanes &b) { return {_mm_cmple_pd(a.v, b.v)}; }
+	inline Mask operator>(const Lanes &a, const Lanes &b) { return {_mm_cmpgt_pd(a.v, b.v)}; }
+	inline Mask operator>=(const Lanes &a, const Lanes &b) { return {_mm_cmpge_pd(a.v, b.v)}; }
+	inline Mask operator==(const Lanes &a, const Lanes &b) { return {_mm_cmpeq_pd(a.v, b.v)}; }
+	inline Mask operator&(const Mask &a, const Mask &b) { return {_mm_and_pd(a.m, b.m)}; }
+	inline Mask operator|(const Mask &a, const Mask &b) { return {_mm_or_pd(a.m, b.m)}; }
+	inline Lanes sel(const Mask &m, const Lanes &a, const Lanes &b)
+	{
+		return _mm_or_pd(_mm_and_pd(m.m, a.v), _mm_andnot_pd(m.m, b.v));
+	}
+#endif
+}
+
+// ╔═══════════════════════════════════════════════════════════════════════════╗
+// ║                                  Kernels                                  ║
+// ╚═══════════════════════════════════════════════════════════════════════════╝
+
+namespace
+{
+	/// Termos de arenaExitTime comuns a todos os disparos de um ponto (g > 0).
+	struct ArenaTerms
+	{
+		double right, left; ///< distância até as bordas laterais
+		double g, floorTerm, ceilTerm;
+
+		ArenaTerms(const glm::vec2 &start, float gravity)
+				: right(kArenaMaxX - start.x), left(kArenaMinX - start.x), g(gravity),
+					floorTerm(2.0 * g * (double(start.y) - kArenaMinY)),
+					ceilTerm(2.0 * g * (double(start.y) - kArenaMaxY))
+		{
+		}
+	};
+
+	/// arenaExitTime de uma pista; todo ramo é calculado e a máscara escolhe.
+	template <class D>
+	D arenaExit(const D &vx, const D &vy, const ArenaTerms &k)
+	{
+		// Saída lateral
+		D t = sel(vx > 0.0, k.right / vx, sel(vx < 0.0, k.left / vx, D(INF)));
+
+		// Queda abaixo do piso: segunda raiz de y(t) = minY.
+		const D dFloor = vy * vy + k.floorTerm;
+		const D rFloor = (vy + root(sel(dFloor >= 0.0, dFloor, 0.0))) / k.g;
+		t = sel((dFloor >= 0.0) & (rFloor < t), rFloor, t);
+
+		// Passagem pelo teto: primeira raiz de y(t) = maxY, se existir.
+		const D dCeil = vy * vy + k.ceilTerm;
+		const D rCeil = (vy - root(sel(dCeil >= 0.0, dCeil, 0.0))) / k.g;
+		t = sel((dCeil >= 0.0) & (rCeil >= 0.0) & (rCeil < t), rCeil, t);
+
+		return sel(t < 0.0, 0.0, t);
+	}
+
+	/// Termos de sweepAABB contra uma caixa fixa, de um ponto fixo (g > 0).
+	struct SweepTerms
+	{
+		double minX, maxX, x0, g, baseTerm, topTerm;
+		double stillLo, stillHi; ///< janela em X quando vx == 0
+
+		SweepTerms(const glm::vec2 &start, float gravity, const glm::vec2 &boxMin,
+							 const glm::vec2 &boxMax, float half)
+				: minX(double(boxMin.x) - half), maxX(double(boxMax.x) + half), x0(start.x), g(gravity)
+		{
+			const double minY = double(boxMin.y) - half, maxY = double(boxMax.y) + half;
+			baseTerm = 2.0 * g * (double(start.y) - minY);
+			topTerm = 2.0 * g * (double(start.y) - maxY);
+			const bool outside = x0 < minX || x0 > maxX;
+			stillLo = outside ? INF : -INF;
+			stillHi = outside ? -INF : INF;
+		}
+	};
+
+	/// sweepAABB de uma pista: primeiro trecho viável ou INF.
+	template <class D>
+	D sweep(const D &vx, const D &vy, const SweepTerms &k)
+	{
+		// 1. Janela de tempo em X (movimento uniforme), restrita a t ≥ 0.
+		const D ax = (k.minX - k.x0) / vx, bx = (k.maxX - k.x0) / vx;
+		D xLo = sel(ax > bx, bx, ax);
+		D xHi = sel(ax > bx, ax, bx);
+		xLo = sel(vx == 0.0, k.stillLo, xLo);
+		xHi = sel(vx == 0.0, k.stillHi, xHi);
+		xLo = sel(xLo < 0.0, 0.0, xLo);
+
+		// 2. y ≥ minY vale em [a, b]; y ≤ maxY vale fora de (c, d).
+		const D dBase = vy * vy + k.baseTerm;
+		const D sBase = root(sel(dBase >= 0.0, dBase, 0.0));
+		const D a = (vy - sBase) / k.g, b = (vy + sBase) / k.g;
+		const D dTop = vy * vy + k.topTerm;
+		const D sTop = root(sel(dTop >= 0.0, dTop, 0.0));
+		const D c = sel(dTop < 0.0, INF, (vy - sTop) / k.g);
+		const D d = sel(dTop < 0.0, INF, (vy + sTop) / k.g);
+
+		// Y = [a, min(b, c)] ∪ [max(a, d), b]; o primeiro trecho viável vence.
+		const D bc = sel(c < b, c, b), ad = sel(a < d, d, a);
+		const D lo1 = sel(xLo < a, a, xLo), hi1 = sel(bc < xHi, bc, xHi);
+		const D lo2 = sel(xLo < ad, ad, xLo), hi2 = sel(b < xHi, b, xHi);
+		D t = sel(lo2 <= hi2, lo2, INF);
+		t = sel(lo1 <= hi1, lo1, t);
+		return sel((xLo > xHi) | (dBase < 0.0), INF, t);
+	}
+
+	/// Aplica `kernel` às n pistas de (vx, vy) e grava em out (float).
+	template <class Kernel>
+	void forEachLane(const float *vx, const float *vy, std::size_t n, float *out, Kernel kernel)
+	{
+		std::size_t i = 0;
+#if defined(GORILLA_SIMD_AVX) || defined(GORILLA_SIMD_SSE2)
+		for (; i + kLanes <= n; i += kLanes)
+			store(out + i, kernel(load(vx + i), load(vy + i)));
+#endif
+		// Restante (ou tudo, sem SIMD): as mesmas contas, uma pista por vez.
+		for (; i < n; ++i)
+			out[i] = float(kernel(double(vx[i]), double(vy[i])));
+	}
+}
+
+// ╔═══════════════════════════════════════════════════════════════════════════╗
+// ║                          Implementação das Funções                        ║
+// ╚═══════════════════════════════════════════════════════════════════════════╝
+
+void evaluateShots(const GameState &s, int shooter, const float *angleDeg,
+									 const float *power, std::size_t n, ShotResult *out)
+{
+	constexpr std::size_t kBlock = 256;
+
+	const float dir = (shooter == 1) ? +1.0f : -1.0f;
+	const Player &me = (shooter == 1) ? s.p1 : s.p2;
+	const Player &target = (shooter == 1) ? s.p2 : s.p1;
+	const glm::vec2 start = launchPoint(me);
+
+	auto write = [&](std::size_t i, const Trajectory &tr, const ShotOutcome &o)
+	{
+		ShotResult &r = out[i];
+		r.time = o.time;
+		r.event = o.event;
+		r.building = o.building;
+		r.impact = tr.at(o.time);
+	};
+
+	// Sem gravidade as contas fechadas seguem outros ramos (o jogo nunca
+	// chega aqui): cada disparo passa por resolveShot.
+	if (!(s.gravity > 0.0f))
+	{
+		for (std::size_t i = 0; i < n; ++i)
+		{
+			const Trajectory tr = makeTrajectory(start, angleDeg[i], power[i], dir, s.gravity);
+			write(i, tr, resolveShot(s, shooter, tr));
+		}
+		return;
+	}
+
+	const ArenaTerms arena(start, s.gravity);
+	const SweepTerms opponent(start, s.gravity, target.pos, target.pos + target.size, kProjectileHalf);
+	std::vector<float> vx(kBlock), vy(kBlock), tExit(kBlock), tPlayer(kBlock);
+
+	for (std::size_t base = 0; base < n; base += kBlock)
+	{
+		const std::size_t count = std::min(kBlock, n - base);
+
+		// Fase 1: velocidades (mesma conversão ângulo → velocidade do jogo).
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			const Trajectory tr = makeTrajectory(start, angleDeg[base + i], power[base + i], dir, s.gravity);
+			vx[i] = tr.velocity.x;
+			vy[i] = tr.velocity.y;
+		}
+
+		// Fase 2: eventos de forma fechada, vários disparos por instrução.
+		forEachLane(vx.data(), vy.data(), count, tExit.data(),
+								[&](const auto &x, const auto &y) { return arenaExit(x, y, arena); });
+		forEachLane(vx.data(), vy.data(), count, tPlayer.data(),
+								[&](const auto &x, const auto &y) { return sweep(x, y, opponent); });
+
+		// Fase 3: prédios, limitados ao primeiro evento já conhecido.
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			Trajectory tr;
+			tr.start = start;
+			tr.velocity = {vx[i], vy[i]};
+			tr.gravity = s.gravity;
+
+			int building = -1;
+			const float tBuilding = s.grid.firstHit(tr, std::min(tExit[i], tPlayer[i]), &building);
+			write(base + i, tr, firstImpact(tBuilding, building, tPlayer[i], tExit[i]));
+		}
+	}
+}
@@ -0,0 +1,39 @@
+#pragma once
+/*
+------------------------------------------------------------------------------
+ ShotBatch.h  –  Avaliação em lote de muitos disparos contra o mesmo cenário
+------------------------------------------------------------------------------
+ Ferramentas de balanceamento precisam testar milhares de pares (ângulo,
+ força) sem mexer no GameState da partida. evaluateShots recebe os parâmetros
+ em arrays e devolve, para cada disparo, onde, quando e no que ele bateu.
+ Os disparos são vetorizados entre si (ver ShotBatch.cpp): a saída da arena
+ e o oponente são calculados para vários disparos por instrução, com as
+ mesmas contas e a mesma ordem de Ballistics.cpp, e os prédios passam pela
+ mesma grade de resolveShot. O resultado é idêntico ao de planShot, bit a
+ bit – ShotBatchTest confere.
+------------------------------------------------------------------------------*/
+
+#include <cstddef>
+
+#include <glm/glm.hpp>
+
+#include "Game.h"
+
+/// Resultado de um disparo avaliado em lote.
+struct ShotResult
+{
+	glm::vec2 impact{0.0f};						 ///< centro do projétil no impacto
+	float time = kNoHit;							 ///< tempo de voo até o impacto
+	StepEvent event = StepEvent::None; ///< HitBuilding, HitPlayer ou OffMap
+	int building = -1;								 ///< índice do prédio atingido, se houver
+};
+
+/**
+ * @brief Avalia n disparos do jogador `shooter` (1 ou 2), lançados da posição
+ *        atual dele no cenário s.
+ * @param angleDeg  n ângulos em graus
+ * @param power     n forças
+ * @param out       n resultados
+ */
+void evaluateShots(const GameState &s, int shooter, const float *angleDeg,
+									 const float *power, std::size_t n, ShotResult *out);
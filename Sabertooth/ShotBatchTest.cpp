@@ -0,0 +1,98 @@
+#include "Game.h"
+#include "ShotBatch.h"
+#include <cstdio>
+#include <cstring>
+#include <vector>
+/*
+------------------------------------------------------------------------------
+ ShotBatchTest.cpp  –  evaluateShots confere com planShot, disparo a disparo
+------------------------------------------------------------------------------
+ ShotBatch.cpp refaz por pista SIMD as contas de arenaExitTime e sweepAABB;
+ este teste varre ângulos e forças dos dois jogadores em dois cenários (o
+ da partida, de initGame, e uma cidade densa) e exige que tempo, evento,
+ prédio e ponto de impacto do lote sejam iguais, bit a bit, aos do disparo
+ que o jogo faria. Roda com `ctest`; código de saída ≠ 0 = divergência.
+------------------------------------------------------------------------------*/
+
+/// Igualdade bit a bit (vale também para kNoHit).
+static bool same(float a, float b)
+{
+	return std::memcmp(&a, &b, sizeof a) == 0;
+}
+
+/// Varre o leque de disparos de `shooter` em s; retorna as divergências.
+static int checkShooter(const char *scene, GameState s, int shooter, int eventsSeen[5])
+{
+	std::vector<float> angles, powers;
+	for (int a = 0; a <= 360; ++a)			 // 0° a 90°, de 0,25 em 0,25
+		for (int p = 0; p <= 152; ++p) // 1 a 20, de 0,125 em 0,125
+		{
+			angles.push_back(a * 0.25f);
+			powers.push_back(1.0f + p * 0.125f);
+		}
+	std::vector<ShotResult> batch(angles.size());
+	evaluateShots(s, shooter, angles.data(), powers.data(), angles.size(), batch.data());
+
+	// O disparo do jogo: mesma preparação de applyInput.
+	s.currentPlayer = shooter;
+	int mismatches = 0;
+	for (std::size_t i = 0; i < angles.size(); ++i)
+	{
+		s.angleDeg = angles[i];
+		s.power = powers[i];
+		if (shooter == 1)
+			s.launchPositionP1 = launchPoint(s.p1);
+		else
+			s.launchPositionP2 = launchPoint(s.p2);
+		planShot(s);
+
+		const ShotResult &r = batch[i];
+		const glm::vec2 impact = s.shot.at(s.impactTime);
+		const int building = resolveShot(s, shooter, s.shot).building;
+		++eventsSeen[static_cast<int>(r.event)];
+		if (same(r.time, s.impactTime) && r.event == s.impactEvent && r.building == building &&
+				same(r.impact.x, impact.x) && same(r.impact.y, impact.y))
+			continue;
+
+		if (++mismatches <= 5)
+			std::printf("  %s, jogador %d, %.2f°, força %.3f: lote t=%.9g evento %d prédio %d, "
+									"jogo t=%.9g evento %d prédio %d\n",
+									scene, shooter, angles[i], powers[i], r.time, static_cast<int>(r.event), r.building,
+									s.impactTime, static_cast<int>(s.impactEvent), building);
+	}
+	return mismatches;
+}
+
+int main()
+{
+	// Cenário da partida.
+	GameState game;
+	initGame(game, nullptr);
+
+	// Cidade densa: prédios estreitos de alturas variadas entre os jogadores,
+	// para a grade ter muitas células ocupadas.
+	GameState dense = game;
+	dense.buildings.clear();
+	for (int i = 0; i < 40; ++i)
+		dense.buildings.push_back({{-6.0f + i * 0.3f, 0.0f}, {0.25f, 1.0f + (i * 7 % 11) * 0.6f}});
+	dense.grid.build(dense.buildings);
+
+	int mismatches = 0;
+	int events[5] = {};
+	for (int shooter = 1; shooter <= 2; ++shooter)
+	{
+		mismatches += checkShooter("partida", game, shooter, events);
+		mismatches += checkShooter("cidade densa", dense, shooter, events);
+	}
+
+	std::printf("ShotBatchTest: prédio %d, oponente %d, fora %d; %d divergências\n",
+							events[static_cast<int>(StepEvent::HitBuilding)],
+							events[static_cast<int>(StepEvent::HitPlayer)],
+							events[static_cast<int>(StepEvent::OffMap)], mismatches);
+
+	// Os três desfechos precisam aparecer, senão a varredura não prova nada.
+	const bool covered = events[static_cast<int>(StepEvent::HitBuilding)] > 0 &&
+											 events[static_cast<int>(StepEvent::HitPlayer)] > 0 &&
+											 events[static_cast<int>(StepEvent::OffMap)] > 0;
+	return (mismatches == 0 && covered) ? 0 : 1;
+}
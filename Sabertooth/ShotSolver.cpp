@@ -0,0 +1,205 @@
+#include "ShotSolver.h"
+#include "ShotBatch.h"
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+/*
+------------------------------------------------------------------------------
+ ShotSolver.cpp  –  Implementação da busca paralela de mira
+------------------------------------------------------------------------------*/
+
+// ╔═══════════════════════════════════════════════════════════════════════════╗
+// ║                             Funções Auxiliares                            ║
+// ╚═══════════════════════════════════════════════════════════════════════════╝
+
+namespace
+{
+	using Clock = std::chrono::steady_clock;
+
+	constexpr float kAngleMin = 0.0f, kAngleMax = 90.0f;
+	constexpr float kPowerMin = 1.0f, kPowerMax = 20.0f;
+	constexpr float kAngleStep = 0.25f; ///< resolução da busca em ângulo
+	constexpr int kStrips = 32;					///< tarefas (faixas de ângulo)
+	constexpr int kNeighbors = 8;				///< forças testadas de cada lado da ideal
+	constexpr float kPowerStep = 0.05f;
+
+	/// Força que leva o centro do projétil de `from` a `to` num campo sem
+	/// obstáculos, para o ângulo dado; < 0 se o ângulo não alcança o alvo.
+	float idealPower(const glm::vec2 &from, const glm::vec2 &to, float angleDeg,
+									 float gravity)
+	{
+		// Com dx medido no sentido do disparo:
+		//   dy = dx·tanθ − g·dx² / (2·v²·cos²θ)  ⇒  v² = g·dx² / (2·cos²θ·(dx·tanθ − dy))
+		const float dx = std::abs(to.x - from.x);
+		const float dy = to.y - from.y;
+		const float rad = glm::radians(angleDeg);
+		const float c = std::cos(rad);
+		const float denom = 2.0f * c * c * (dx * std::tan(rad) - dy);
+		if (c <= 0.0f || denom <= 0.0f)
+			return -1.0f;
+		return std::sqrt(gravity * dx * dx / denom);
+	}
+
+	/// Estado compartilhado por todas as tarefas de uma busca. Vive num
+	/// shared_ptr: solve() pode voltar no prazo com tarefas ainda na fila, e
+	/// elas usam a própria cópia do cenário, não a partida que segue rodando.
+	struct Search
+	{
+		GameState state; ///< cópia do cenário no início da busca
+		int shooter = 1;
+		glm::vec2 from{0.0f}, aim{0.0f}; ///< ponto de disparo e centro do alvo
+
+		std::atomic<bool> cancel{false};
+		Clock::time_point deadline;
+
+		std::mutex m;
+		std::condition_variable done;
+		int remaining = 0;	///< tarefas ainda não concluídas
+		AimSolution best;		///< melhor mira até agora
+		bool hasBest = false;
+
+		void offer(const AimSolution &a)
+		{
+			std::lock_guard<std::mutex> lock(m);
+			if (!hasBest || (a.hit && !best.hit) || (a.hit == best.hit && a.missDistance < best.missDistance))
+			{
+				best = a;
+				hasBest = true;
+			}
+			if (a.hit)
+				cancel.store(true, std::memory_order_relaxed); // cancelamento antecipado
+		}
+
+		void finishTask()
+		{
+			std::lock_guard<std::mutex> lock(m);
+			if (--remaining == 0)
+				done.notify_all();
+		}
+
+		/// Saída antecipada: acerto encontrado, prazo vencido ou busca abandonada.
+		[[nodiscard]] bool stopped() const
+		{
+			return cancel.load(std::memory_order_relaxed) || Clock::now() >= deadline;
+		}
+	};
+
+	/// Uma faixa de ângulos. Faixas intercaladas: a tarefa k testa k,
+	/// k + kStrips, ... para que todas varram o intervalo inteiro de forma
+	/// grossa primeiro.
+	void searchStrip(Search &search, int strip, int anglesTotal, int perStrip)
+	{
+		const GameState &s = search.state;
+		float angles[2 * kNeighbors + 1];
+		float powers[2 * kNeighbors + 1];
+		ShotResult results[2 * kNeighbors + 1];
+
+		for (int j = 0; j < perStrip; ++j)
+		{
+			if (search.stopped()) // tarefas que só começam depois do prazo saem aqui
+				break;
+			const int index = strip + j * kStrips;
+			if (index >= anglesTotal)
+				break;
+
+			const float angle = kAngleMin + index * kAngleStep;
+			const float ideal = idealPower(search.from, search.aim, angle, s.gravity);
+			if (ideal < kPowerMin || ideal > kPowerMax)
+				continue;
+
+			// A ideal primeiro, depois vizinhos alternando abaixo/acima.
+			int n = 0;
+			for (int k = 0; k <= 2 * kNeighbors; ++k)
+			{
+				const int offset = (k % 2 == 0) ? k / 2 : -(k + 1) / 2;
+				const float p = ideal + offset * kPowerStep;
+				if (p < kPowerMin || p > kPowerMax)
+					continue;
+				angles[n] = angle;
+				powers[n] = p;
+				++n;
+			}
+			evaluateShots(s, search.shooter, angles, powers, static_cast<std::size_t>(n), results);
+
+			for (int k = 0; k < n; ++k)
+			{
+				AimSolution a;
+				a.angleDeg = angles[k];
+				a.power = powers[k];
+				a.hit = (results[k].event == StepEvent::HitPlayer);
+				a.missDistance = a.hit ? 0.0f : glm::length(results[k].impact - search.aim);
+				search.offer(a);
+				if (a.hit)
+					break;
+			}
+		}
+	}
+}
+
+// ╔═══════════════════════════════════════════════════════════════════════════╗
+// ║                          Implementação da Busca                           ║
+// ╚═══════════════════════════════════════════════════════════════════════════╝
+
+ShotSolver::ShotSolver(ThreadPool &workers) : pool(workers) {}
+
+AimSolution ShotSolver::solve(const GameState &s, int shooter,
+															std::chrono::microseconds budget)
+{
+	const Clock::time_point deadline = Clock::now() + budget;
+
+	const Player &me = (shooter == 1) ? s.p1 : s.p2;
+	const Player &target = (shooter == 1) ? s.p2 : s.p1;
+	const glm::vec2 from = launchPoint(me);
+	const glm::vec2 aim = target.pos + target.size * 0.5f;
+
+	// Palpite em tempo constante pela tabela balística do cenário: se ele já
+	// acerta (conferido com os jogadores), nem chega a usar as threads.
+	if (s.aimTable && !s.aimTable->empty())
+	{
+		const AimTable::Aim guess = s.aimTable->aimFor(shooter, from.x, aim.x);
+		if (guess.valid)
+		{
+			ShotResult r;
+			evaluateShots(s, shooter, &guess.angleDeg, &guess.power, 1, &r);
+			if (r.event == StepEvent::HitPlayer)
+				return {true, guess.angleDeg, guess.power, 0.0f};
+		}
+	}
+
+	auto search = std::make_shared<Search>();
+	search->state = s;
+	search->shooter = shooter;
+	search->from = from;
+	search->aim = aim;
+	search->deadline = deadline;
+	search->remaining = kStrips;
+
+	const int anglesTotal = static_cast<int>((kAngleMax - kAngleMin) / kAngleStep) + 1;
+	const int perStrip = (anglesTotal + kStrips - 1) / kStrips;
+	for (int strip = 0; strip < kStrips; ++strip)
+		pool.submit([search, strip, anglesTotal, perStrip]
+								{
+			searchStrip(*search, strip, anglesTotal, perStrip);
+			search->finishTask(); });
+
+	// Espera o fim das tarefas até o prazo e volta com a melhor mira até lá.
+	// O pool é compartilhado (ex.: decodificação de texturas), então faixas
+	// ainda na fila podem demorar a começar: não são esperadas, só canceladas.
+	std::unique_lock<std::mutex> lock(search->m);
+	search->done.wait_until(lock, deadline, [&]
+													{ return search->remaining == 0; });
+	search->cancel.store(true, std::memory_order_relaxed);
+
+	if (!search->hasBest)
+	{
+		// Nenhum ângulo alcançável (ou nenhum testado a tempo): mantém a mira atual.
+		AimSolution keep;
+		keep.angleDeg = s.angleDeg;
+		keep.power = s.power;
+		return keep;
+	}
+	return search->best;
+}
@@ -0,0 +1,46 @@
+#pragma once
+/*
+------------------------------------------------------------------------------
+ ShotSolver.h  –  Oponente controlado pelo computador (busca de mira)
+------------------------------------------------------------------------------
+ Procura um par (ângulo 0–90, força 1–20) que acerte a caixa do oponente.
+ O palpite da tabela balística (AimTable) é testado antes de tudo.
+ O intervalo de ângulos é dividido em faixas que rodam em paralelo no
+ ThreadPool; para cada ângulo a força "ideal" sem obstáculos sai da equação da
+ parábola e só alguns vizinhos dela são conferidos com evaluateShots (com os
+ prédios). Ao primeiro acerto as demais tarefas são canceladas, e a busca
+ toda respeita um orçamento de tempo por turno – se ele acabar, devolve na
+ hora o disparo que chegou mais perto. Tarefas ainda na fila do pool (que
+ pode estar ocupado com outros trabalhos) não são esperadas: elas trabalham
+ numa cópia do cenário e saem assim que começam.
+------------------------------------------------------------------------------*/
+
+#include <chrono>
+
+#include "Game.h"
+#include "ThreadPool.h"
+
+/// Mira encontrada pela busca.
+struct AimSolution
+{
+	bool hit = false;					 ///< true se o disparo acerta o oponente
+	float angleDeg = 45.0f;		 ///< ângulo escolhido
+	float power = 5.0f;				 ///< força escolhida
+	float missDistance = 0.0f; ///< distância do impacto ao alvo (0 se acerta)
+};
+
+class ShotSolver
+{
+public:
+	explicit ShotSolver(ThreadPool &pool);
+
+	/**
+	 * @brief Busca uma mira para `shooter` (1 ou 2) no cenário de s.
+	 *        Bloqueia no máximo ~budget, mesmo com o pool ocupado.
+	 */
+	AimSolution solve(const GameState &s, int shooter,
+										std::chrono::microseconds budget = std::chrono::microseconds(2000));
+
+private:
+	ThreadPool &pool;
+};
@@ -0,0 +1,79 @@
+#include "StreamBuffer.h"
+#include <iostream>
+/*
+------------------------------------------------------------------------------
+ StreamBuffer.cpp  –  Implementação do buffer mapeado persistentemente
+------------------------------------------------------------------------------*/
+
+void StreamBuffer::init(GLsizeiptr bytesPerFrame)
+{
+	frameSize = bytesPerFrame;
+	const GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+
+	glGenBuffers(1, &buffer);
+	glBindBuffer(GL_COPY_WRITE_BUFFER, buffer);
+	glBufferStorage(GL_COPY_WRITE_BUFFER, frameSize * kFrames, nullptr, flags);
+	mapped = static_cast<unsigned char *>(glMapBufferRange(GL_COPY_WRITE_BUFFER, 0, frameSize * kFrames, flags));
+	if (!mapped)
+		std::cerr << "[StreamBuffer] glMapBufferRange falhou\n";
+
+	// Começa "no fim" da última região: o primeiro beginFrame() vai à região 0.
+	frame = kFrames - 1;
+	head = frameSize * kFrames;
+}
+
+void StreamBuffer::destroy()
+{
+	for (GLsync &f : fences)
+	{
+		if (f)
+			glDeleteSync(f);
+		f = nullptr;
+	}
+	if (mapped)
+	{
+		glBindBuffer(GL_COPY_WRITE_BUFFER, buffer);
+		glUnmapBuffer(GL_COPY_WRITE_BUFFER);
+	}
+	glDeleteBuffers(1, &buffer);
+	buffer = 0;
+	mapped = nullptr;
+}
+
+void StreamBuffer::beginFrame()
+{
+	frame = (frame + 1) % kFrames;
+	head = frameSize * frame;
+
+	GLsync &fence = fences[frame];
+	if (!fence)
+		return;
+
+	// FLUSH só na primeira tentativa: garante que a fence chegue à GPU.
+	GLbitfield waitFlags = GL_SYNC_FLUSH_COMMANDS_BIT;
+	for (;;)
+	{
+		const GLenum r = glClientWaitSync(fence, waitFlags, 1000000000); // 1 s
+		if (r == GL_ALREADY_SIGNALED || r == GL_CONDITION_SATISFIED || r == GL_WAIT_FAILED)
+			break;
+		waitFlags = 0;
+	}
+	glDeleteSync(fence);
+	fence = nullptr;
+}
+
+void StreamBuffer::endFrame()
+{
+	if (fences[frame])
+		glDeleteSync(fences[frame]);
+	fences[frame] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+}
+
+StreamSlice StreamBuffer::alloc(GLsizeiptr size, GLsizeiptr align)
+{
+	const GLsizeiptr start = (head + align - 1) / align * align;
+	if (!mapped || start + size > frameSize * (frame + 1))
+		return {}; // região cheia: aumentar bytesPerFrame
+	head = start + size;
+	return {mapped + start, start};
+}
@@ -0,0 +1,59 @@
+#pragma once
+/*
+------------------------------------------------------------------------------
+ StreamBuffer.h  –  Buffer mapeado persistentemente para dados por quadro
+------------------------------------------------------------------------------
+ Um único buffer criado com glBufferStorage e mapeado uma vez só
+ (MAP_PERSISTENT | MAP_COHERENT): a CPU escreve direto na memória que a GPU
+ lê, sem glBufferData/glBufferSubData por quadro.
+
+ O buffer é dividido em kFrames regiões (triple buffering). Cada quadro
+ escreve na sua região; endFrame() põe uma fence atrás dos comandos que a
+ leem e beginFrame(), kFrames quadros depois, espera essa fence antes de
+ reaproveitar a região. Com a GPU até dois quadros atrás, a espera não
+ acontece na prática – e nunca há o sincronismo implícito que o driver faria
+ ao sobrescrever um buffer em uso.
+
+ Uniform blocks (UniformRing), instâncias (InstancedCubes) e, no futuro,
+ rastros e partículas dividem o mesmo buffer: cada um pede fatias com
+ alloc() e usa o deslocamento em glBindBufferRange/glBindVertexBuffer.
+------------------------------------------------------------------------------*/
+
+#include <GL/glew.h>
+
+/// Fatia de uma região: ponteiro para escrever e deslocamento no buffer.
+struct StreamSlice
+{
+	void *ptr = nullptr; ///< nullptr se a região do quadro encheu
+	GLintptr offset = 0;
+};
+
+class StreamBuffer
+{
+public:
+	static constexpr int kFrames = 3; ///< regiões em uso ao mesmo tempo
+
+	/// Cria e mapeia kFrames · bytesPerFrame bytes.
+	void init(GLsizeiptr bytesPerFrame);
+	void destroy();
+
+	/// Passa para a próxima região, esperando a GPU terminar de lê-la.
+	void beginFrame();
+
+	/// Marca (fence) o fim dos comandos que leem a região atual.
+	void endFrame();
+
+	/// Reserva `size` bytes alinhados a `align` na região do quadro. A
+	/// memória é válida até o beginFrame() que reutilizar a região.
+	StreamSlice alloc(GLsizeiptr size, GLsizeiptr align);
+
+	[[nodiscard]] GLuint id() const { return buffer; }
+
+private:
+	GLuint buffer = 0;
+	unsigned char *mapped = nullptr;
+	GLsizeiptr frameSize = 0;
+	int frame = 0;					///< região atual
+	GLsizeiptr head = 0;		///< próximo byte livre (absoluto no buffer)
+	GLsync fences[kFrames] = {};
+};
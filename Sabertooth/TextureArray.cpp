@@ -0,0 +1,69 @@
+#include "TextureArray.h"
+#include <cstring>
+#include <vector>
+/*
+------------------------------------------------------------------------------
+ TextureArray.cpp  –  Implementação do array de texturas
+------------------------------------------------------------------------------*/
+
+void TextureArray::init(int width, int height, int layers, Format format)
+{
+	w = width;
+	h = height;
+	n = layers;
+	fmt = format;
+
+	// Níveis de mipmap até 1×1.
+	mips = 1;
+	for (int s = (w > h ? w : h); s > 1; s /= 2)
+		++mips;
+
+	const GLenum internal = (fmt == Format::DXT5) ? GL_COMPRESSED_RGBA_S3TC_DXT5_EXT : GL_RGBA8;
+	glGenTextures(1, &tex);
+	glBindTexture(GL_TEXTURE_2D_ARRAY, tex);
+	glTexStorage3D(GL_TEXTURE_2D_ARRAY, mips, internal, w, h, n);
+	glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+	glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+	glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_S, GL_REPEAT);
+	glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_T, GL_REPEAT);
+
+	// Provisório: cinza opaco em todas as camadas (mesma cor do TextureLoader).
+	if (fmt == Format::DXT5)
+	{
+		// Bloco 4×4 de cor única: alfa 255 e as duas cores RGB565 = (128,128,128).
+		static const unsigned char greyBlock[16] = {255, 255, 0, 0, 0, 0, 0, 0,
+																								0x10, 0x84, 0x10, 0x84, 0, 0, 0, 0};
+		int lw = w, lh = h;
+		for (int level = 0; level < mips; ++level)
+		{
+			const size_t blocks = static_cast<size_t>((lw + 3) / 4) * ((lh + 3) / 4) * n;
+			std::vector<unsigned char> grey(blocks * sizeof greyBlock);
+			for (size_t b = 0; b < blocks; ++b)
+				std::memcpy(&grey[b * sizeof greyBlock], greyBlock, sizeof greyBlock);
+			glCompressedTexSubImage3D(GL_TEXTURE_2D_ARRAY, level, 0, 0, 0, lw, lh, n,
+																GL_COMPRESSED_RGBA_S3TC_DXT5_EXT, static_cast<GLsizei>(grey.size()), grey.data());
+			lw = (lw > 1) ? lw / 2 : 1;
+			lh = (lh > 1) ? lh / 2 : 1;
+		}
+		return;
+	}
+	std::vector<unsigned char> grey(static_cast<size_t>(w) * h * n * 4, 128);
+	for (size_t i = 3; i < grey.size(); i += 4)
+		grey[i] = 255;
+	glTexSubImage3D(GL_TEXTURE_2D_ARRAY, 0, 0, 0, 0, w, h, n, GL_RGBA, GL_UNSIGNED_BYTE, grey.data());
+	glGenerateMipmap(GL_TEXTURE_2D_ARRAY);
+}
+
+void TextureArray::destroy()
+{
+	glDeleteTextures(1, &tex);
+	tex = 0;
+	w = h = n = mips = 0;
+}
+
+void TextureArray::bind(GLuint unit) const
+{
+	glActiveTexture(GL_TEXTURE0 + unit);
+	glBindTexture(GL_TEXTURE_2D_ARRAY, tex);
+	glActiveTexture(GL_TEXTURE0);
+}
@@ -0,0 +1,46 @@
+#pragma once
+/*
+------------------------------------------------------------------------------
+ TextureArray.h  –  Todas as texturas de sprites num único GL_TEXTURE_2D_ARRAY
+------------------------------------------------------------------------------
+ Prédios, jogadores e skins futuras viram camadas de um só objeto de textura
+ (todas com o mesmo tamanho e formato, com mipmaps). O shader escolhe a
+ camada por instância (iLayer), então a cena inteira de cubos desenha com um
+ único bind de textura. As imagens chegam pelo TextureLoader::requestLayer:
+   • DXT5: cada camada é um .dds cozido no tamanho dela (TextureCooker
+     --layer), enviado nível a nível com a cadeia de mipmaps pronta;
+   • RGBA8: a imagem original é decodificada e redimensionada na carga, e
+     o GL gera os mipmaps depois da última camada.
+------------------------------------------------------------------------------*/
+
+#include <GL/glew.h>
+
+class TextureArray
+{
+public:
+	enum class Format
+	{
+		RGBA8, ///< decodificado na carga
+		DXT5	 ///< blocos cozidos pelo TextureCooker (exige GL_EXT_texture_compression_s3tc)
+	};
+
+	/// Aloca `layers` camadas width×height com todos os níveis de mipmap
+	/// (imutável, glTexStorage3D) e as preenche de cinza até as imagens chegarem.
+	void init(int width, int height, int layers, Format format = Format::RGBA8);
+	void destroy();
+
+	/// Liga o array na unidade de textura `unit`.
+	void bind(GLuint unit) const;
+
+	[[nodiscard]] GLuint id() const { return tex; }
+	[[nodiscard]] int width() const { return w; }
+	[[nodiscard]] int height() const { return h; }
+	[[nodiscard]] int layers() const { return n; }
+	[[nodiscard]] int levels() const { return mips; }
+	[[nodiscard]] Format format() const { return fmt; }
+
+private:
+	GLuint tex = 0;
+	int w = 0, h = 0, n = 0, mips = 0;
+	Format fmt = Format::RGBA8;
+};
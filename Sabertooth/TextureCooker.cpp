@@ -0,0 +1,166 @@
+/*
+------------------------------------------------------------------------------
+ TextureCooker.cpp  –  Ferramenta de linha de comando que "cozinha" texturas
+------------------------------------------------------------------------------
+ Uso:  TextureCooker [--blur R] [--layer N] imagem.jpg [imagem.png ...]
+
+ Para cada imagem grava, ao lado dela, um .dds com o mesmo nome: DXT1 se a
+ imagem é opaca, DXT5 se tem alfa, com a cadeia de mipmaps inteira já
+ gerada (média 2×2, como glGenerateMipmap). O TextureLoader do jogo prefere
+ esse arquivo ao original, então basta rodar a ferramenta de novo sempre que
+ uma imagem mudar. --blur R aplica às imagens seguintes o mesmo desfoque
+ gaussiano que o jogo faz na carga (ImageFilters.h) – o fundo usa o raio
+ BG_BLUR_RADIUS de main.cpp – e grava o raio no .dds; o jogo recusa o
+ arquivo se o raio não for o que ele pede. --layer N cozinha as imagens seguintes para uma
+ camada de TextureArray: redimensiona para N×N (como o TextureLoader faria na
+ carga) e grava sempre DXT5, o formato único do array – os sprites usam
+ --layer 256 (SPRITE_SIZE de main.cpp).
+
+ A compressão usa o codificador DXT do SOIL2 (External/SOIL2/include/
+ image_DXT.c, compilado neste projeto); a leitura usa o mesmo stb_image do
+ jogo, com a mesma inversão vertical.
+------------------------------------------------------------------------------*/
+
+#define STB_IMAGE_IMPLEMENTATION
+#include "stb_image.h"
+
+extern "C"
+{
+#include "image_DXT.h"
+}
+
+#include "Dds.h"
+#include "ImageFilters.h"
+
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// ╔═══════════════════════════════════════════════════════════════════════════╗
+// ║                             Funções Auxiliares                            ║
+// ╚═══════════════════════════════════════════════════════════════════════════╝
+
+static bool hasAlpha(const std::vector<unsigned char> &rgba)
+{
+	for (size_t i = 3; i < rgba.size(); i += 4)
+		if (rgba[i] != 255)
+			return true;
+	return false;
+}
+
+/// Próximo nível de mipmap (média de 2×2; dimensões ímpares repetem a borda).
+static std::vector<unsigned char> halve(const std::vector<unsigned char> &src, int w, int h)
+{
+	const int nw = (w > 1) ? w / 2 : 1;
+	const int nh = (h > 1) ? h / 2 : 1;
+	std::vector<unsigned char> dst(size_t(nw) * nh * 4);
+	for (int y = 0; y < nh; ++y)
+		for (int x = 0; x < nw; ++x)
+		{
+			const int x0 = 2 * x < w ? 2 * x : w - 1, x1 = 2 * x + 1 < w ? 2 * x + 1 : w - 1;
+			const int y0 = 2 * y < h ? 2 * y : h - 1, y1 = 2 * y + 1 < h ? 2 * y + 1 : h - 1;
+			for (int c = 0; c < 4; ++c)
+			{
+				const int sum = src[(size_t(y0) * w + x0) * 4 + c] + src[(size_t(y0) * w + x1) * 4 + c] +
+												src[(size_t(y1) * w + x0) * 4 + c] + src[(size_t(y1) * w + x1) * 4 + c];
+				dst[(size_t(y) * nw + x) * 4 + c] = static_cast<unsigned char>((sum + 2) / 4);
+			}
+		}
+	return dst;
+}
+
+/// Converte uma imagem; retorna false (com mensagem) se algo falhar.
+/// @param layerSize  > 0: redimensiona para layerSize² e força DXT5
+static bool cook(const std::string &path, int blurRadius, int layerSize)
+{
+	int w, h, c;
+	stbi_set_flip_vertically_on_load(1);
+	unsigned char *data = stbi_load(path.c_str(), &w, &h, &c, STBI_rgb_alpha);
+	if (!data)
+	{
+		std::cerr << "Falha ao carregar " << path << "\n";
+		return false;
+	}
+	gaussianBlurRGBA(data, w, h, blurRadius);
+	if (layerSize > 0 && (w != layerSize || h != layerSize))
+	{
+		unsigned char *resized = resizeRGBA(data, w, h, layerSize, layerSize);
+		stbi_image_free(data);
+		if (!resized)
+		{
+			std::cerr << "Falha ao redimensionar " << path << "\n";
+			return false;
+		}
+		data = resized;
+		w = h = layerSize;
+	}
+	std::vector<unsigned char> level(data, data + size_t(w) * h * 4);
+	stbi_image_free(data);
+
+	DdsImage img;
+	img.format = (layerSize > 0 || hasAlpha(level)) ? DdsFormat::DXT5 : DdsFormat::DXT1;
+	img.blurRadius = blurRadius > 0 ? blurRadius : 0; // o jogo confere com o raio que pede
+
+	size_t rawBytes = 0;
+	for (;;)
+	{
+		int size = 0;
+		unsigned char *blocks = (img.format == DdsFormat::DXT1)
+																? convert_image_to_DXT1(level.data(), w, h, 4, &size)
+																: convert_image_to_DXT5(level.data(), w, h, 4, &size);
+		if (!blocks)
+		{
+			std::cerr << "Falha ao comprimir " << path << " (" << w << "x" << h << ")\n";
+			return false;
+		}
+		img.levels.push_back({w, h, img.data.size(), size_t(size)});
+		img.data.insert(img.data.end(), blocks, blocks + size);
+		std::free(blocks);
+		rawBytes += level.size();
+
+		if (w == 1 && h == 1)
+			break;
+		level = halve(level, w, h);
+		w = (w > 1) ? w / 2 : 1;
+		h = (h > 1) ? h / 2 : 1;
+	}
+
+	const std::string out = cookedPath(path);
+	if (!saveDds(out, img))
+	{
+		std::cerr << "Falha ao gravar " << out << "\n";
+		return false;
+	}
+	std::cout << path << " -> " << out << "  " << img.levels[0].width << "x" << img.levels[0].height
+						<< (img.format == DdsFormat::DXT1 ? " DXT1, " : " DXT5, ") << img.levels.size()
+						<< " niveis, " << rawBytes << " -> " << img.data.size() << " bytes ("
+						<< double(rawBytes) / double(img.data.size()) << "x)\n";
+	return true;
+}
+
+// ╔═══════════════════════════════════════════════════════════════════════════╗
+// ║                                   main                                    ║
+// ╚═══════════════════════════════════════════════════════════════════════════╝
+int main(int argc, char **argv)
+{
+	if (argc < 2)
+	{
+		std::cerr << "Uso: " << argv[0] << " [--blur R] [--layer N] imagem [imagem ...]\n"
+							<< "Grava <imagem>.dds (DXT1/DXT5 com mipmaps) ao lado de cada entrada.\n"
+							<< "--layer N: camada de TextureArray (N×N, sempre DXT5).\n";
+		return 1;
+	}
+
+	int failures = 0, blurRadius = 0, layerSize = 0;
+	for (int i = 1; i < argc; ++i)
+	{
+		if (std::string(argv[i]) == "--blur" && i + 1 < argc)
+			blurRadius = std::atoi(argv[++i]);
+		else if (std::string(argv[i]) == "--layer" && i + 1 < argc)
+			layerSize = std::atoi(argv[++i]);
+		else
+			failures += cook(argv[i], blurRadius, layerSize) ? 0 : 1;
+	}
+	return failures ? 1 : 0;
+}
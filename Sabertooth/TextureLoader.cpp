@@ -0,0 +1,276 @@
+#include "TextureLoader.h"
+#include "ImageFilters.h"
+#include "Logger.h"
+#include "TextureArray.h"
+#include "ThreadPool.h"
+#include "stb_image.h"
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <iterator>
+/*
+------------------------------------------------------------------------------
+ TextureLoader.cpp  –  Implementação do carregamento assíncrono
+------------------------------------------------------------------------------*/
+
+TextureLoader::TextureLoader(ThreadPool &pool, bool useCooked) : pool(pool), useCooked(useCooked) {}
+
+TextureLoader::~TextureLoader()
+{
+	std::unique_lock<std::mutex> lock(m);
+	finished.wait(lock, [this]
+								{ return decoding == 0; });
+	for (Decoded &d : ready)
+		stbi_image_free(d.pixels);
+}
+
+GLuint TextureLoader::request(const std::string &path, int blurRadius)
+{
+	// Provisória: 1×1 já é completa para GL_LINEAR_MIPMAP_LINEAR.
+	const unsigned char grey[4] = {128, 128, 128, 255};
+	GLuint id;
+	glGenTextures(1, &id);
+	glBindTexture(GL_TEXTURE_2D, id);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
+	glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, 1, 1, 0, GL_RGBA, GL_UNSIGNED_BYTE, grey);
+
+	{
+		std::lock_guard<std::mutex> lock(m);
+		++decoding;
+	}
+	pool.submit([this, id, path, blurRadius]
+							{
+		// Versão cozida primeiro, se o desfoque bate; senão decodifica o
+		// original. A opção de inverter é por thread: não interfere em outras
+		// decodificações.
+		Decoded d{id, -1, path, 0, 0, nullptr, {}};
+		if (useCooked && loadDds(cookedPath(path), d.dds) && d.dds.blurRadius != blurRadius)
+		{
+			logWarn("%s foi cozido com desfoque %d, o jogo pede %d (TextureCooker --blur %d): "
+							"usando o original",
+							cookedPath(path).c_str(), d.dds.blurRadius, blurRadius, blurRadius);
+			d.dds = {};
+		}
+		if (d.dds.levels.empty())
+		{
+			int c;
+			stbi_set_flip_vertically_on_load_thread(1);
+			d.pixels = stbi_load(path.c_str(), &d.width, &d.height, &c, STBI_rgb_alpha);
+			if (d.pixels)
+				gaussianBlurRGBA(d.pixels, d.width, d.height, blurRadius);
+		}
+
+		std::lock_guard<std::mutex> lock(m);
+		ready.push_back(std::move(d));
+		if (--decoding == 0)
+			finished.notify_all(); });
+	return id;
+}
+
+void TextureLoader::requestLayer(const std::string &path, const TextureArray &array, int layer)
+{
+	{
+		std::lock_guard<std::mutex> lock(m);
+		++decoding;
+	}
+	++pendingLayers[array.id()].count;
+	const int w = array.width(), h = array.height(), levels = array.levels();
+	const bool compressed = array.format() == TextureArray::Format::DXT5;
+	pool.submit([this, id = array.id(), layer, path, w, h, levels, compressed]
+							{
+		Decoded d{id, layer, path, 0, 0, nullptr, {}};
+		if (compressed)
+		{
+			// Array DXT5: só serve o .dds cozido para a camada (mesmo tamanho e
+			// todos os níveis); não há como enviar RGBA para ele.
+			DdsImage img;
+			if (loadDds(cookedPath(path), img) && img.format == DdsFormat::DXT5 &&
+					img.levels[0].width == w && img.levels[0].height == h &&
+					static_cast<int>(img.levels.size()) >= levels)
+				d.dds = std::move(img);
+			else
+				logError("%s não foi cozido para a camada %dx%d (TextureCooker --layer %d)",
+								 cookedPath(path).c_str(), w, h, w);
+		}
+		else
+		{
+			int iw, ih, c;
+			stbi_set_flip_vertically_on_load_thread(1);
+			if (unsigned char *src = stbi_load(path.c_str(), &iw, &ih, &c, STBI_rgb_alpha))
+			{
+				d.width = w;
+				d.height = h;
+				if (iw == w && ih == h)
+					d.pixels = src;
+				else
+				{
+					d.pixels = resizeRGBA(src, iw, ih, w, h);
+					stbi_image_free(src);
+				}
+			}
+		}
+
+		std::lock_guard<std::mutex> lock(m);
+		ready.push_back(std::move(d));
+		if (--decoding == 0)
+			finished.notify_all(); });
+}
+
+int TextureLoader::poll(int maxUploads)
+{
+	std::vector<Decoded> batch;
+	{
+		std::lock_guard<std::mutex> lock(m);
+		const size_t n = std::min(ready.size(), static_cast<size_t>(maxUploads > 0 ? maxUploads : 0));
+		batch.assign(std::make_move_iterator(ready.begin()), std::make_move_iterator(ready.begin() + n));
+		ready.erase(ready.begin(), ready.begin() + n);
+	}
+
+	for (const Decoded &d : batch)
+	{
+		const bool pixelLayer = d.layer >= 0 && d.pixels;
+		if (!d.dds.levels.empty())
+			(d.layer >= 0) ? uploadCompressedLayer(d) : uploadCompressed(d);
+		else if (d.pixels)
+		{
+			upload(d);
+			stbi_image_free(d.pixels);
+		}
+		else
+			logError("Falha ao carregar %s", d.path.c_str());
+
+		// Camadas RGBA: os mipmaps do array são gerados uma só vez, depois da
+		// última camada pedida (até lá os níveis menores continuam cinza).
+		if (d.layer >= 0)
+		{
+			PendingLayers &p = pendingLayers[d.texture];
+			p.mipmapsStale |= pixelLayer;
+			if (--p.count == 0)
+			{
+				if (p.mipmapsStale)
+				{
+					glBindTexture(GL_TEXTURE_2D_ARRAY, d.texture);
+					glGenerateMipmap(GL_TEXTURE_2D_ARRAY);
+				}
+				pendingLayers.erase(d.texture);
+			}
+		}
+	}
+	return static_cast<int>(batch.size());
+}
+
+bool TextureLoader::fillPbo(const void *src, GLsizeiptr bytes)
+{
+	// Reenviar o tamanho com nullptr "orfana" o conteúdo anterior, então a
+	// cópia abaixo não espera a GPU terminar de ler a imagem passada.
+	if (bytes > pboCapacity)
+		pboCapacity = bytes;
+	glBufferData(GL_PIXEL_UNPACK_BUFFER, pboCapacity, nullptr, GL_STREAM_DRAW);
+	void *dst = glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, bytes,
+															 GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT);
+	if (!dst)
+		return false;
+	std::memcpy(dst, src, static_cast<size_t>(bytes));
+	glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+	return true;
+}
+
+void TextureLoader::upload(const Decoded &d)
+{
+	if (!pbo)
+		glGenBuffers(1, &pbo);
+	glBindBuffer(GL_PIXEL_UNPACK_BUFFER, pbo);
+
+	if (fillPbo(d.pixels, static_cast<GLsizeiptr>(d.width) * d.height * 4))
+	{
+		// Com um PBO ligado, o "ponteiro" é um deslocamento dentro dele: o
+		// driver copia para a textura sem bloquear esta thread.
+		if (d.layer >= 0)
+		{
+			glBindTexture(GL_TEXTURE_2D_ARRAY, d.texture);
+			glTexSubImage3D(GL_TEXTURE_2D_ARRAY, 0, 0, 0, d.layer, d.width, d.height, 1,
+											GL_RGBA, GL_UNSIGNED_BYTE, (void *)0);
+		}
+		else
+		{
+			glBindTexture(GL_TEXTURE_2D, d.texture);
+			glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, d.width, d.height, 0, GL_RGBA, GL_UNSIGNED_BYTE, (void *)0);
+			glGenerateMipmap(GL_TEXTURE_2D);
+		}
+	}
+	else
+		logError("Falha ao mapear o PBO para %s", d.path.c_str());
+
+	// Desliga: chamadas glTexImage2D com ponteiro comum voltam a funcionar.
+	glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+}
+
+void TextureLoader::uploadCompressed(const Decoded &d)
+{
+	const DdsImage &img = d.dds;
+	if (!pbo)
+		glGenBuffers(1, &pbo);
+	glBindBuffer(GL_PIXEL_UNPACK_BUFFER, pbo);
+
+	if (fillPbo(img.data.data(), static_cast<GLsizeiptr>(img.data.size())))
+	{
+		// Todos os níveis já vêm do arquivo; MAX_LEVEL cobre cadeias incompletas.
+		const GLenum format = (img.format == DdsFormat::DXT1) ? GL_COMPRESSED_RGB_S3TC_DXT1_EXT
+																													: GL_COMPRESSED_RGBA_S3TC_DXT5_EXT;
+		glBindTexture(GL_TEXTURE_2D, d.texture);
+		for (size_t i = 0; i < img.levels.size(); ++i)
+		{
+			const DdsLevel &l = img.levels[i];
+			glCompressedTexImage2D(GL_TEXTURE_2D, static_cast<GLint>(i), format, l.width, l.height, 0,
+														 static_cast<GLsizei>(l.size), (void *)l.offset);
+		}
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, static_cast<GLint>(img.levels.size() - 1));
+	}
+	else
+		logError("Falha ao mapear o PBO para %s", d.path.c_str());
+
+	glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+}
+
+void TextureLoader::uploadCompressedLayer(const Decoded &d)
+{
+	const DdsImage &img = d.dds;
+	if (!pbo)
+		glGenBuffers(1, &pbo);
+	glBindBuffer(GL_PIXEL_UNPACK_BUFFER, pbo);
+
+	if (fillPbo(img.data.data(), static_cast<GLsizeiptr>(img.data.size())))
+	{
+		// Só os níveis que o array tem (requestLayer já conferiu que há todos).
+		GLint levels = 0;
+		glBindTexture(GL_TEXTURE_2D_ARRAY, d.texture);
+		glGetTexParameteriv(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_IMMUTABLE_LEVELS, &levels);
+		for (GLint i = 0; i < levels && i < static_cast<GLint>(img.levels.size()); ++i)
+		{
+			const DdsLevel &l = img.levels[i];
+			glCompressedTexSubImage3D(GL_TEXTURE_2D_ARRAY, i, 0, 0, d.layer, l.width, l.height, 1,
+																GL_COMPRESSED_RGBA_S3TC_DXT5_EXT, static_cast<GLsizei>(l.size),
+																(void *)l.offset);
+		}
+	}
+	else
+		logError("Falha ao mapear o PBO para %s", d.path.c_str());
+
+	glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+}
+
+bool TextureLoader::idle()
+{
+	std::lock_guard<std::mutex> lock(m);
+	return decoding == 0 && ready.empty();
+}
+
+void TextureLoader::destroy()
+{
+	glDeleteBuffers(1, &pbo);
+	pbo = 0;
+	pboCapacity = 0;
+}
@@ -0,0 +1,106 @@
+#pragma once
+/*
+------------------------------------------------------------------------------
+ TextureLoader.h  –  Carregamento assíncrono de texturas
+------------------------------------------------------------------------------
+ request() cria na hora uma textura provisória (1×1 cinza) e devolve o seu
+ identificador; a decodificação do arquivo (stb_image) roda numa thread do
+ ThreadPool. poll(), chamado uma vez por quadro na thread do OpenGL, envia as
+ imagens já decodificadas através de um pixel buffer object para a MESMA
+ textura – quem guardou o identificador não precisa trocar nada.
+
+ Com N arquivos e threads suficientes, o tempo até todas as texturas estarem
+ prontas é o da decodificação mais lenta, e a janela aparece antes disso.
+
+ Se existir uma versão "cozida" ao lado do arquivo (mesmo nome, extensão
+ .dds, gerada pelo TextureCooker), ela é usada no lugar: a thread só lê os
+ blocos DXT e poll() os envia com glCompressedTexImage2D, mipmaps inclusos –
+ nada de decodificar nem de glGenerateMipmap. O desfoque pedido a request()
+ (ex.: o do fundo) roda depois de decodificar; um .dds só é aceito se foi
+ cozido com o mesmo raio (TextureCooker --blur), senão o original é
+ decodificado e desfocado na carga. Sem a extensão S3TC
+ no driver, o .dds é ignorado e o original sempre é decodificado.
+------------------------------------------------------------------------------*/
+
+#include <GL/glew.h>
+#include "Dds.h"
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+class TextureArray;
+class ThreadPool;
+
+class TextureLoader
+{
+public:
+	/// @param useCooked  false = ignora os .dds (driver sem S3TC/DXT)
+	explicit TextureLoader(ThreadPool &pool, bool useCooked = true);
+
+	/// Aguarda as decodificações em andamento (elas referenciam este objeto).
+	~TextureLoader();
+
+	TextureLoader(const TextureLoader &) = delete;
+	TextureLoader &operator=(const TextureLoader &) = delete;
+
+	/// Textura provisória imediata; o conteúdo de `path` chega em um poll().
+	/// @param blurRadius  desfoque gaussiano (ImageFilters.h) aplicado na
+	///                    thread de trabalho; 0 = nenhum
+	GLuint request(const std::string &path, int blurRadius = 0);
+
+	/// Preenche a camada `layer` de `array` com `path`. Array DXT5: lê o .dds
+	/// cozido para a camada (TextureCooker --layer) e envia todos os níveis.
+	/// RGBA8: decodifica e redimensiona o original (na thread de trabalho);
+	/// os mipmaps são gerados quando a última camada pedida chega. Até o
+	/// poll() que a envia, a camada mantém o cinza provisório do array.
+	void requestLayer(const std::string &path, const TextureArray &array, int layer);
+
+	/// Envia até `maxUploads` imagens prontas (limita o custo por quadro).
+	/// @return quantas texturas foram atualizadas
+	int poll(int maxUploads = 4);
+
+	/// Verdadeiro quando não há decodificação nem envio pendente.
+	[[nodiscard]] bool idle();
+
+	/// Libera o pixel buffer (chamar com o contexto ativo).
+	void destroy();
+
+private:
+	/// Resultado de uma decodificação (pixels == nullptr e dds vazio se falhou).
+	struct Decoded
+	{
+		GLuint texture;
+		int layer;						 ///< camada de GL_TEXTURE_2D_ARRAY, ou −1 (GL_TEXTURE_2D)
+		std::string path;
+		int width, height;
+		unsigned char *pixels; ///< RGBA, alocado pelo stb_image
+		DdsImage dds;					 ///< blocos prontos, se havia versão .dds
+	};
+
+	ThreadPool &pool;
+	const bool useCooked;
+
+	std::mutex m;
+	std::condition_variable finished;
+	std::vector<Decoded> ready; ///< protegido por m
+	int decoding = 0;						///< protegido por m
+
+	GLuint pbo = 0;
+	GLsizeiptr pboCapacity = 0;
+
+	/// Camadas pedidas e ainda não enviadas, por array (só na thread do GL).
+	struct PendingLayers
+	{
+		int count = 0;
+		bool mipmapsStale = false; ///< alguma camada RGBA chegou sem mipmaps
+	};
+	std::unordered_map<GLuint, PendingLayers> pendingLayers;
+
+	/// Copia `bytes` de src para o PBO (já ligado); false se não mapeou.
+	bool fillPbo(const void *src, GLsizeiptr bytes);
+	void upload(const Decoded &d);
+	void uploadCompressed(const Decoded &d);
+	void uploadCompressedLayer(const Decoded &d);
+};
@@ -0,0 +1,106 @@
+#include "ThreadPool.h"
+#include <algorithm>
+/*
+------------------------------------------------------------------------------
+ ThreadPool.cpp  –  Implementação do conjunto de threads
+------------------------------------------------------------------------------*/
+
+namespace
+{
+	/// Índice da thread atual no conjunto dono dela (ou −1 fora dele).
+	thread_local const ThreadPool *tlsPool = nullptr;
+	thread_local int tlsIndex = -1;
+}
+
+ThreadPool::ThreadPool(unsigned threads)
+{
+	if (threads == 0)
+		threads = std::max(1u, std::thread::hardware_concurrency());
+
+	for (unsigned i = 0; i < threads; ++i)
+		queues.push_back(std::make_unique<Queue>());
+	for (unsigned i = 0; i < threads; ++i)
+		workers.emplace_back([this, i]
+												 { workerLoop(i); });
+}
+
+ThreadPool::~ThreadPool()
+{
+	{
+		std::lock_guard<std::mutex> lock(sleepMutex);
+		stopping = true;
+	}
+	wake.notify_all();
+	for (std::thread &t : workers)
+		t.join();
+}
+
+void ThreadPool::submit(std::function<void()> task)
+{
+	const unsigned target = (tlsPool == this)
+															? static_cast<unsigned>(tlsIndex)
+															: next.fetch_add(1, std::memory_order_relaxed) % size();
+	{
+		std::lock_guard<std::mutex> lock(queues[target]->m);
+		queues[target]->tasks.push_back(std::move(task));
+	}
+	{
+		// Incrementa sob o mutex de espera para não perder o aviso de uma
+		// thread que acabou de testar o predicado e vai dormir.
+		std::lock_guard<std::mutex> lock(sleepMutex);
+		pending.fetch_add(1, std::memory_order_relaxed);
+	}
+	wake.notify_one();
+}
+
+bool ThreadPool::tryPop(unsigned self, std::function<void()> &task)
+{
+	// 1. Própria fila, pelo fim (tarefa mais recente).
+	{
+		Queue &q = *queues[self];
+		std::lock_guard<std::mutex> lock(q.m);
+		if (!q.tasks.empty())
+		{
+			task = std::move(q.tasks.back());
+			q.tasks.pop_back();
+			return true;
+		}
+	}
+	// 2. Rouba pelo início das filas vizinhas (tarefa mais antiga).
+	for (unsigned k = 1; k < size(); ++k)
+	{
+		Queue &q = *queues[(self + k) % size()];
+		std::lock_guard<std::mutex> lock(q.m);
+		if (!q.tasks.empty())
+		{
+			task = std::move(q.tasks.front());
+			q.tasks.pop_front();
+			return true;
+		}
+	}
+	return false;
+}
+
+void ThreadPool::workerLoop(unsigned self)
+{
+	tlsPool = this;
+	tlsIndex = static_cast<int>(self);
+
+	std::function<void()> task;
+	for (;;)
+	{
+		if (tryPop(self, task))
+		{
+			pending.fetch_sub(1, std::memory_order_relaxed);
+			task();
+			task = nullptr;
+			continue;
+		}
+
+		std::unique_lock<std::mutex> lock(sleepMutex);
+		wake.wait(lock, [this]
+							{ return stopping || pending.load(std::memory_order_relaxed) > 0; });
+		if (stopping && pending.load(std::memory_order_relaxed) == 0)
+			return;
+	}
+}
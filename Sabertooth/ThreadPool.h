@@ -0,0 +1,56 @@
+#pragma once
+/*
+------------------------------------------------------------------------------
+ ThreadPool.h  –  Conjunto de threads com roubo de tarefas (work stealing)
+------------------------------------------------------------------------------
+ Cada thread tem sua própria fila. Tarefas criadas por uma thread do conjunto
+ vão para a fila dela (e são retiradas pelo fim – LIFO, mais quente no cache);
+ as demais são distribuídas em rodízio. Uma thread sem trabalho rouba do
+ início da fila das outras, equilibrando a carga sem uma fila global única.
+------------------------------------------------------------------------------*/
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+class ThreadPool
+{
+public:
+	/// @param threads  quantidade de threads (0 = núcleos da máquina)
+	explicit ThreadPool(unsigned threads = 0);
+	~ThreadPool();
+
+	ThreadPool(const ThreadPool &) = delete;
+	ThreadPool &operator=(const ThreadPool &) = delete;
+
+	/// Enfileira uma tarefa; ela roda em alguma thread do conjunto.
+	void submit(std::function<void()> task);
+
+	[[nodiscard]] unsigned size() const { return static_cast<unsigned>(queues.size()); }
+
+private:
+	struct Queue
+	{
+		std::mutex m;
+		std::deque<std::function<void()>> tasks;
+	};
+
+	std::vector<std::unique_ptr<Queue>> queues;
+	std::vector<std::thread> workers;
+
+	std::mutex sleepMutex;
+	std::condition_variable wake;
+	std::atomic<int> pending{0};	 ///< tarefas enfileiradas ainda não retiradas
+	std::atomic<unsigned> next{0}; ///< rodízio para tarefas vindas de fora
+	bool stopping = false;				 ///< protegido por sleepMutex
+
+	/// Retira da própria fila ou rouba de outra.
+	bool tryPop(unsigned self, std::function<void()> &task);
+
+	void workerLoop(unsigned self);
+};
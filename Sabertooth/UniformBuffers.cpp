@@ -0,0 +1,30 @@
+#include "UniformBuffers.h"
+#include <cstring>
+/*
+------------------------------------------------------------------------------
+ UniformBuffers.cpp  –  Implementação do anel de blocos uniform
+------------------------------------------------------------------------------*/
+
+void UniformRing::init(StreamBuffer &target, GLuint bindingPoint)
+{
+	stream = &target;
+	binding = bindingPoint;
+
+	// glBindBufferRange exige offsets múltiplos do alinhamento do driver
+	// (tipicamente 256 bytes).
+	GLint a = 256;
+	glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &a);
+	align = a;
+}
+
+bool UniformRing::push(const void *data, GLsizeiptr size)
+{
+	const StreamSlice slice = stream->alloc(size, align);
+	if (!slice.ptr)
+		return false;
+
+	// Memória coerente: a GPU vê a cópia sem flush nem glBufferSubData.
+	std::memcpy(slice.ptr, data, static_cast<size_t>(size));
+	glBindBufferRange(GL_UNIFORM_BUFFER, binding, stream->id(), slice.offset, size);
+	return true;
+}
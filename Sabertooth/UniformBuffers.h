@@ -0,0 +1,65 @@
+#pragma once
+/*
+------------------------------------------------------------------------------
+ UniformBuffers.h  –  Blocos uniform (std140) em buffers na GPU
+------------------------------------------------------------------------------
+ Os dados de cada bloco vão para fatias de um StreamBuffer (mapeado
+ persistentemente): UniformRing::push() copia os bytes para a próxima fatia
+ e um glBindBufferRange a seleciona no ponto de ligação do bloco – uma
+ chamada em vez de um glUniform* por campo. O bloco Frame (câmera e tempo)
+ é enviado uma vez por quadro e vale para todo programa que o declara; o
+ bloco Object, uma vez por desenho.
+
+ As structs abaixo espelham os blocos de shaders/scene.vert e scene.frag;
+ os static_assert pegam campos fora da regra de alinhamento std140.
+------------------------------------------------------------------------------*/
+
+#include <GL/glew.h>
+#include <glm/glm.hpp>
+
+#include "StreamBuffer.h"
+
+/// Pontos de ligação (Shader::bindBlock e glBindBufferBase/Range).
+constexpr GLuint kFrameBinding = 0;
+constexpr GLuint kObjectBinding = 1;
+
+/// Bloco Frame: escrito uma vez por quadro.
+struct FrameUniforms
+{
+	glm::mat4 view{1.0f};
+	glm::mat4 projection{1.0f};
+	float time = 0.0f; ///< segundos desde o início (glfwGetTime)
+	float pad[3] = {}; ///< std140: o bloco é múltiplo de 16 bytes
+};
+static_assert(sizeof(FrameUniforms) == 144, "layout std140 do bloco Frame");
+
+/// Bloco Object: um por desenho.
+struct ObjectUniforms
+{
+	glm::mat4 model{1.0f};
+	glm::vec4 color{1.0f}; ///< cor sólida, se useColor
+	GLint useColor = GL_FALSE;
+	GLint instanced = GL_FALSE; ///< transformação vem do buffer de instâncias
+	GLint pad[2] = {};
+};
+static_assert(sizeof(ObjectUniforms) == 96, "layout std140 do bloco Object");
+
+class UniformRing
+{
+public:
+	/// Cada push() ocupa uma fatia de `stream` e a liga em `binding`.
+	void init(StreamBuffer &stream, GLuint binding);
+
+	/// Copia `size` bytes para uma fatia nova e a liga em `binding`; vale
+	/// para os desenhos seguintes, até o próximo push().
+	/// @return false se a região do quadro no StreamBuffer acabou
+	bool push(const void *data, GLsizeiptr size);
+
+	template <class T>
+	bool push(const T &value) { return push(&value, sizeof(T)); }
+
+private:
+	StreamBuffer *stream = nullptr;
+	GLuint binding = 0;
+	GLsizeiptr align = 256; ///< GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT
+};
@@ -1,11 +1,20 @@
-// ============================================================================
+﻿// ============================================================================
 // main.cpp  –  Ponto de entrada do Gorillas 3D
 // ============================================================================
 
 #include <GL/glew.h>
 #include <GLFW/glfw3.h>
 
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
 #include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
 #include <clocale> // UTF‑8 no terminal
 #ifdef _WIN32
 #include <windows.h> // para SetConsoleOutputCP
@@ -13,7 +22,6 @@
 
 #include <glm/glm.hpp>
 #include <glm/gtc/matrix_transform.hpp>
-#include <glm/gtc/type_ptr.hpp>
 
 #define STB_IMAGE_IMPLEMENTATION
 #include "stb_image.h"
@@ -21,6 +29,21 @@
 #include "Shader.h"
 #include "Geometry.h"
 #include "Game.h"
+#include "FileWatcher.h"
+#include "FixedTimestep.h"
+#include "HeadlessContext.h"
+#include "InputSystem.h"
+#include "Logger.h"
+#include "ShotSolver.h"
+#include "StreamBuffer.h"
+#include "InstancedCubes.h"
+#include "MeshCache.h"
+#include "PostProcess.h"
+#include "Profiler.h"
+#include "RenderQueue.h"
+#include "TextureArray.h"
+#include "TextureLoader.h"
+#include "UniformBuffers.h"
 
 // ╔═══════════════════════════════════════════════════════════════════════════╗
 // ║                      Constantes de Janela / App                          ║
@@ -28,70 +51,163 @@
 constexpr int WIN_WIDTH = 800;
 constexpr int WIN_HEIGHT = 600;
 constexpr char TITLE[] = "Gorillas 3D – Universidade";
-
-// ╔═══════════════════════════════════════════════════════════════════════════╗
-// ║                  Substituto simples para std::clamp                       ║
-// ╚═══════════════════════════════════════════════════════════════════════════╝
-static inline float clampf(float v, float mn, float mx)
-{
-	return (v < mn ? mn : (v > mx ? mx : v));
-}
+constexpr float PHYSICS_HZ = 120.0f; ///< passos de física por segundo
+constexpr int AI_PLAYER = 2;				 ///< jogador controlado pelo computador (0 = dois humanos)
+constexpr float MOVE_SPEED = 0.3f;	 ///< deslocamento do jogador por segundo de tecla
+constexpr float ANGLE_RATE = 12.0f;	 ///< graus por segundo de tecla
+constexpr float POWER_RATE = 1.2f;	 ///< força por segundo de tecla
+constexpr std::chrono::microseconds AI_BUDGET(2000); ///< tempo máximo de busca por turno
+constexpr int BG_BLUR_RADIUS = 2; ///< desfoque do fundo, uma vez na carga (city_bg.dds: --blur igual)
+constexpr int BLOOM_DOWNSAMPLE = 4; ///< brilho da explosão desfocado em 1/4 da resolução
+constexpr int BLOOM_RADIUS = 6;			///< raio do brilho, em pixels da resolução reduzida
+constexpr char SCENE_VS[] = "shaders/scene.vert"; ///< recarregados ao salvar (FileWatcher)
+constexpr char SCENE_FS[] = "shaders/scene.frag";
+constexpr double HEADLESS_DT = 1.0 / 60.0; ///< tempo simulado por quadro no modo sem janela
 
 // ╔═══════════════════════════════════════════════════════════════════════════╗
 // ║                         Handles OpenGL globais                            ║
 // ╚═══════════════════════════════════════════════════════════════════════════╝
 GLuint bgVAO = 0, bgVBO = 0;
 GLuint cubeVAO = 0, cubeVBO = 0;
-GLuint sphereVAO = 0, sphereVBO = 0;
-GLsizei sphereVertexCount = 0;
 
-GLuint texBG = 0, texBuilding = 0, texP1 = 0, texP2 = 0;
+GLuint texBG = 0;
+bool s3tcSupported = false; ///< GL_EXT_texture_compression_s3tc: dá para usar os .dds
+
+// Camadas do array de sprites (o mesmo valor vai em CubeInstance::layer).
+constexpr int LAYER_BUILDING = 0, LAYER_P1 = 1, LAYER_P2 = 2, SPRITE_LAYERS = 3;
+constexpr int SPRITE_SIZE = 256; ///< largura e altura de cada camada
+TextureArray sprites;						 ///< prédios e jogadores, um só objeto de textura
 
-Shader *gShader = nullptr;
+InstancedCubes cubes; ///< prédios e jogadores, desenhados por instância
+MeshCache meshes;			///< esferas indexadas, uma por (raio, stacks, slices)
+const GpuMesh *projectileMesh = nullptr;
+const GpuMesh *explosionMesh = nullptr;
+
+RenderTarget sceneTarget; ///< substitui a janela no modo sem janela (fbo 0 = janela)
+RenderTarget glowTarget;	///< só a explosão, para gerar o brilho
+GaussianBlur bloom;
+Compositor compositor;
+
+std::unique_ptr<Shader> gShader;
+
+// Estado da partida (toda a lógica vive em Game.cpp / GorillaCore)
+static GameState game;
+
+// Dados que mudam a cada quadro: blocos uniform e instâncias dos jogadores,
+// num só buffer mapeado persistentemente (uma região por quadro em voo). Os
+// prédios ficam fora dele (InstancedCubes::setStatic).
+constexpr GLsizeiptr STREAM_BYTES_PER_FRAME = 64 * 1024;
+StreamBuffer stream;
+UniformRing frameRing;	///< bloco Frame: câmera e tempo
+UniformRing objectRing; ///< bloco Object: um por desenho
+RenderQueue queue;			///< desenhos do quadro, executados ordenados por estado
+RenderQueue::Stats frameDraws; ///< soma dos flush() do quadro atual
 
 struct
 {
-	GLint model, view, proj;
-	GLint useColor, overrideColor, blur, sampler;
+	GLint sampler, spriteSampler;
 } uni;
 
 // ╔═══════════════════════════════════════════════════════════════════════════╗
-// ║                       Utilitário de Carregamento de Textura               ║
+// ║                     Inicialização da Janela e OpenGL                      ║
 // ╚═══════════════════════════════════════════════════════════════════════════╝
-static GLuint loadTexture(const char *path)
-{
-	GLuint id;
-	glGenTextures(1, &id);
-	glBindTexture(GL_TEXTURE_2D, id);
-
-	// Filtragem e repetição
-	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
-	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
-	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
-
-	int w, h, c;
-	stbi_set_flip_vertically_on_load(true);
-	unsigned char *data = stbi_load(path, &w, &h, &c, STBI_rgb_alpha);
-	if (!data)
+/// Funções além do GL 1.1 que o renderizador chama sem testar antes. As
+/// opcionais (ex.: glMaxShaderCompilerThreadsKHR) ficam de fora: quem as usa
+/// confere a extensão.
+static bool hasRequiredEntryPoints()
+{
+#define GORILLA_GL_ENTRY(f) {#f, f != nullptr}
+	const struct
 	{
-		std::cerr << "Falha ao carregar " << path << "\n";
-		return 0;
+		const char *name;
+		bool loaded;
+	} required[] = {
+			GORILLA_GL_ENTRY(glActiveTexture),
+			GORILLA_GL_ENTRY(glBeginQuery),
+			GORILLA_GL_ENTRY(glBindBufferRange),
+			GORILLA_GL_ENTRY(glBindFramebuffer),
+			GORILLA_GL_ENTRY(glBindVertexArray),
+			GORILLA_GL_ENTRY(glBindVertexBuffer),
+			GORILLA_GL_ENTRY(glBufferStorage),
+			GORILLA_GL_ENTRY(glClearBufferfv),
+			GORILLA_GL_ENTRY(glClientWaitSync),
+			GORILLA_GL_ENTRY(glCompressedTexImage2D),
+			GORILLA_GL_ENTRY(glCompressedTexSubImage3D),
+			GORILLA_GL_ENTRY(glDrawArraysInstancedBaseInstance),
+			GORILLA_GL_ENTRY(glDrawElementsInstancedBaseInstance),
+			GORILLA_GL_ENTRY(glFenceSync),
+			GORILLA_GL_ENTRY(glFramebufferRenderbuffer),
+			GORILLA_GL_ENTRY(glFramebufferTexture2D),
+			GORILLA_GL_ENTRY(glGenerateMipmap),
+			GORILLA_GL_ENTRY(glGetProgramBinary),
+			GORILLA_GL_ENTRY(glGetQueryObjectui64v),
+			GORILLA_GL_ENTRY(glGetUniformBlockIndex),
+			GORILLA_GL_ENTRY(glMapBufferRange),
+			GORILLA_GL_ENTRY(glProgramBinary),
+			GORILLA_GL_ENTRY(glProgramParameteri),
+			GORILLA_GL_ENTRY(glRenderbufferStorage),
+			GORILLA_GL_ENTRY(glTexStorage2D),
+			GORILLA_GL_ENTRY(glTexStorage3D),
+			GORILLA_GL_ENTRY(glTexSubImage3D),
+			GORILLA_GL_ENTRY(glUniformBlockBinding),
+			GORILLA_GL_ENTRY(glVertexAttribBinding),
+			GORILLA_GL_ENTRY(glVertexAttribFormat),
+			GORILLA_GL_ENTRY(glVertexBindingDivisor),
+	};
+#undef GORILLA_GL_ENTRY
+
+	bool ok = true;
+	for (const auto &e : required)
+		if (!e.loaded)
+		{
+			logError("OpenGL sem %s.", e.name);
+			ok = false;
+		}
+	return ok;
+}
+
+/// Estado fixo do pipeline; vale para a janela e para o contexto sem janela.
+/// @param headless  contexto EGL: aceita o GLEW compilado para GLX, que
+///                  carrega as funções e só depois falha por não achar um
+///                  display GLX (um GLEW com GLEW_EGL devolve GLEW_OK)
+static bool initGL(bool headless)
+{
+	glewExperimental = GL_TRUE;
+	const GLenum err = glewInit();
+	bool loaded = (err == GLEW_OK);
+#ifdef GLEW_ERROR_NO_GLX_DISPLAY
+	loaded = loaded || (headless && err == GLEW_ERROR_NO_GLX_DISPLAY);
+#endif
+	if (!loaded)
+	{
+		logError("Erro ao inicializar GLEW: %s", reinterpret_cast<const char *>(glewGetErrorString(err)));
+		return false;
 	}
-	glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, w, h, 0, GL_RGBA, GL_UNSIGNED_BYTE, data);
-	glGenerateMipmap(GL_TEXTURE_2D);
-	stbi_image_free(data);
-	return id;
+	while (glGetError() != GL_NO_ERROR) // glewInit deixa GL_INVALID_ENUM no perfil core
+		;
+	if (!GLEW_VERSION_4_4 || !hasRequiredEntryPoints())
+	{
+		logError("O renderizador precisa de OpenGL 4.4 (contexto: %s).",
+						 reinterpret_cast<const char *>(glGetString(GL_VERSION)));
+		return false;
+	}
+	// DXT não é núcleo do GL 4.4: sem a extensão os .dds dariam GL_INVALID_ENUM.
+	s3tcSupported = GLEW_EXT_texture_compression_s3tc;
+	if (!s3tcSupported)
+		logWarn("Driver sem GL_EXT_texture_compression_s3tc: os .dds serão ignorados.");
+
+	glViewport(0, 0, WIN_WIDTH, WIN_HEIGHT);
+	glEnable(GL_DEPTH_TEST);
+	glEnable(GL_BLEND);
+	glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+	return true;
 }
 
-// ╔═══════════════════════════════════════════════════════════════════════════╗
-// ║                     Inicialização da Janela e OpenGL                      ║
-// ╚═══════════════════════════════════════════════════════════════════════════╝
 static GLFWwindow *createWindow()
 {
 	if (!glfwInit())
 	{
-		std::cerr << "Erro ao iniciar GLFW.\n";
+		logError("Erro ao iniciar GLFW.");
 		return nullptr;
 	}
 	glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 4);
@@ -101,23 +217,14 @@ static GLFWwindow *createWindow()
 	GLFWwindow *win = glfwCreateWindow(WIN_WIDTH, WIN_HEIGHT, TITLE, nullptr, nullptr);
 	if (!win)
 	{
-		std::cerr << "Erro ao criar janela.\n";
+		logError("Erro ao criar janela.");
 		glfwTerminate();
 		return nullptr;
 	}
 	glfwMakeContextCurrent(win);
 
-	glewExperimental = GL_TRUE;
-	if (glewInit() != GLEW_OK)
-	{
-		std::cerr << "Erro ao inicializar GLEW.\n";
+	if (!initGL(false))
 		return nullptr;
-	}
-
-	glViewport(0, 0, WIN_WIDTH, WIN_HEIGHT);
-	glEnable(GL_DEPTH_TEST);
-	glEnable(GL_BLEND);
-	glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
 	return win;
 }
 
@@ -150,262 +257,708 @@ static void buildGeometry()
 	glEnableVertexAttribArray(0);
 	glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 5 * sizeof(float), (void *)(3 * sizeof(float)));
 	glEnableVertexAttribArray(1);
+	cubes.init(cubeVBO, stream);
 
-	// Esfera (projétil/explosão)
-	std::vector<float> sp = generateSphereVertices(0.2f, 16, 16);
-	sphereVertexCount = (GLsizei)(sp.size() / 6);
-	glGenVertexArrays(1, &sphereVAO);
-	glGenBuffers(1, &sphereVBO);
-	glBindVertexArray(sphereVAO);
-	glBindBuffer(GL_ARRAY_BUFFER, sphereVBO);
-	glBufferData(GL_ARRAY_BUFFER, sp.size() * sizeof(float), sp.data(), GL_STATIC_DRAW);
-	glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 6 * sizeof(float), (void *)0);
-	glEnableVertexAttribArray(0);
-	glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, 6 * sizeof(float), (void *)(3 * sizeof(float)));
-	glEnableVertexAttribArray(1);
+	// Esferas indexadas: o projétil é pequeno; a explosão cresce até ~7× e
+	// usa mais divisões para a silhueta continuar redonda.
+	projectileMesh = &meshes.sphere(0.2f, 16, 16);
+	explosionMesh = &meshes.sphere(0.2f, 32, 32);
+}
+
+/// Alvos e programas do pós-processamento (brilho da explosão).
+static void buildPostProcess()
+{
+	glowTarget.init(WIN_WIDTH, WIN_HEIGHT);
+	bloom.init(WIN_WIDTH, WIN_HEIGHT, BLOOM_DOWNSAMPLE);
+	compositor.init();
+	gShader->use(); // os init acima trocam o programa ativo
 }
 
 // ╔═══════════════════════════════════════════════════════════════════════════╗
 // ║                          Carregamento de Texturas                         ║
 // ╚═══════════════════════════════════════════════════════════════════════════╝
-static void loadAllTextures()
+/// Sprites, na ordem das camadas (LAYER_BUILDING, LAYER_P1, LAYER_P2).
+static const char *const SPRITE_FILES[SPRITE_LAYERS] = {
+		"building_texture_2.jpg", "player1_texture.png", "player2_texture.png"};
+
+/// DXT5 se o driver tem S3TC e todos os sprites foram cozidos no tamanho da
+/// camada (TextureCooker --layer 256); basta um faltar para o array ser RGBA8.
+static TextureArray::Format spriteFormat()
+{
+	if (!s3tcSupported)
+		return TextureArray::Format::RGBA8;
+	for (const char *file : SPRITE_FILES)
+	{
+		DdsImage header;
+		if (!loadDdsHeader(cookedPath(file), header) || header.format != DdsFormat::DXT5 ||
+				header.levels[0].width != SPRITE_SIZE || header.levels[0].height != SPRITE_SIZE)
+			return TextureArray::Format::RGBA8;
+	}
+	return TextureArray::Format::DXT5;
+}
+
+/// Pede as quatro texturas de uma vez: as decodificações correm em paralelo
+/// e os identificadores já são válidos (provisórios até o poll() do quadro).
+/// Os sprites vão para camadas do array; o fundo continua numa textura 2D.
+static void loadAllTextures(TextureLoader &loader)
 {
-	texBG = loadTexture("city_bg.jpg");
-	texBuilding = loadTexture("building_texture_2.jpg");
-	texP1 = loadTexture("player1_texture.png");
-	texP2 = loadTexture("player2_texture.png");
+	texBG = loader.request("city_bg.jpg", BG_BLUR_RADIUS);
+
+	sprites.init(SPRITE_SIZE, SPRITE_SIZE, SPRITE_LAYERS, spriteFormat());
+	for (int layer = 0; layer < SPRITE_LAYERS; ++layer)
+		loader.requestLayer(SPRITE_FILES[layer], sprites, layer);
 }
 
 // ╔═══════════════════════════════════════════════════════════════════════════╗
 // ║                           Setup do Shader                                 ║
 // ╚═══════════════════════════════════════════════════════════════════════════╝
+/// Programa da cena, lido de shaders/ (editável com o jogo aberto).
 static void createShader()
 {
-	const char *vs = R"(
-        #version 440 core
-        layout(location=0) in vec3 aPos;
-        layout(location=1) in vec2 aUV;
-        out vec2 vUV;
-        uniform mat4 model, view, projection;
-        void main() {
-            vUV = aUV;
-            gl_Position = projection * view * model * vec4(aPos, 1.0);
-        }
-    )";
-
-	const char *fs = R"(
-        #version 440 core
-        in vec2 vUV;
-        out vec4 FragColor;
-        uniform sampler2D tex;
-        uniform bool useColor;
-        uniform bool blur;
-        uniform vec3 overrideColor;
-
-        vec3 applyBlur(vec2 uv) {
-            vec2 sz = vec2(textureSize(tex, 0));
-            vec2 off = 1.0 / sz;
-            vec3 col = vec3(0.0);
-            for(int y = -1; y <= 1; ++y)
-                for(int x = -1; x <= 1; ++x)
-                    col += texture(tex, uv + vec2(x, y)*off).rgb;
-            return col / 9.0;
-        }
-
-        void main() {
-            if (useColor) {
-                FragColor = vec4(overrideColor, 1.0);
-                return;
-            }
-
-            vec4 texel = texture(tex, vUV);
-
-            // Transparência real – descarta fundo branco
-            if (texel.a < 0.1) discard;
-
-            vec3 rgb = blur ? applyBlur(vUV) : texel.rgb;
-            FragColor = vec4(rgb, texel.a);
-        }
-    )";
-
-	gShader = new Shader(vs, fs);
+	gShader = Shader::fromFiles(SCENE_VS, SCENE_FS);
+}
+
+/// Samplers e pontos de ligação dos blocos. Repetido a cada recarga do
+/// shader: o programa novo começa com todos os uniforms zerados.
+static void bindSceneUniforms()
+{
 	gShader->use();
+	gShader->bindBlock("Frame", kFrameBinding);
+	gShader->bindBlock("Object", kObjectBinding);
 
-	uni.model = glGetUniformLocation(gShader->getProgramID(), "model");
-	uni.view = glGetUniformLocation(gShader->getProgramID(), "view");
-	uni.proj = glGetUniformLocation(gShader->getProgramID(), "projection");
-	uni.useColor = glGetUniformLocation(gShader->getProgramID(), "useColor");
-	uni.overrideColor = glGetUniformLocation(gShader->getProgramID(), "overrideColor");
-	uni.blur = glGetUniformLocation(gShader->getProgramID(), "blur");
 	uni.sampler = glGetUniformLocation(gShader->getProgramID(), "tex");
+	uni.spriteSampler = glGetUniformLocation(gShader->getProgramID(), "sprites");
 	glUniform1i(uni.sampler, 0);
+	glUniform1i(uni.spriteSampler, 1);
+}
 
-	// Matriz de câmera fixa
-	glm::mat4 view = glm::mat4(1.0f);
-	glm::mat4 proj = glm::ortho(-10.0f, 10.0f, -1.0f, 10.0f, -1.0f, 1.0f);
-	glUniformMatrix4fv(uni.view, 1, GL_FALSE, glm::value_ptr(view));
-	glUniformMatrix4fv(uni.proj, 1, GL_FALSE, glm::value_ptr(proj));
+/// Buffer de streaming e os blocos Frame e Object que escrevem nele
+/// (ligados aos mesmos pontos em qualquer programa que os declare).
+static void buildStreamBuffers()
+{
+	stream.init(STREAM_BYTES_PER_FRAME);
+	frameRing.init(stream, kFrameBinding);
+	objectRing.init(stream, kObjectBinding);
+}
+
+/// Câmera fixa e relógio do quadro: um único envio para todos os desenhos.
+static void updateFrameUniforms(double time)
+{
+	FrameUniforms frame;
+	frame.view = glm::mat4(1.0f);
+	frame.projection = glm::ortho(-10.0f, 10.0f, -1.0f, 10.0f, -1.0f, 1.0f);
+	frame.time = static_cast<float>(time);
+	frameRing.push(frame);
 }
 
 // ╔═══════════════════════════════════════════════════════════════════════════╗
 // ║                       Entrada de Usuário (Teclado)                        ║
 // ╚═══════════════════════════════════════════════════════════════════════════╝
-static void processInput(GLFWwindow *win, float dt)
-{
-	const float move = 0.005f;
+// As teclas viram eventos (InputSystem) e cada passo fixo recebe quanto
+// tempo cada ação ficou ativa nele: as taxas abaixo são por segundo, então
+// a mira anda na mesma velocidade com qualquer taxa de quadros.
 
-	// Movimento horizontal somente para o jogador da vez
-	if (glfwGetKey(win, GLFW_KEY_A) == GLFW_PRESS)
-		(currentPlayer == 1 ? p1.pos.x : p2.pos.x) -= move;
-	if (glfwGetKey(win, GLFW_KEY_D) == GLFW_PRESS)
-		(currentPlayer == 1 ? p1.pos.x : p2.pos.x) += move;
+static void bindControls(InputSystem &controls)
+{
+	controls.bind(GLFW_KEY_A, Action::MoveLeft);
+	controls.bind(GLFW_KEY_D, Action::MoveRight);
+	controls.bind(GLFW_KEY_LEFT, Action::AngleDown);
+	controls.bind(GLFW_KEY_RIGHT, Action::AngleUp);
+	controls.bind(GLFW_KEY_DOWN, Action::PowerDown);
+	controls.bind(GLFW_KEY_UP, Action::PowerUp);
+	controls.bind(GLFW_KEY_SPACE, Action::Fire);
+	controls.bind(GLFW_KEY_ESCAPE, Action::Quit);
+}
 
-	// Limites de faixa
-	if (currentPlayer == 1)
-		p1.pos.x = clampf(p1.pos.x, -10.0f, -6.0f);
-	else
-		p2.pos.x = clampf(p2.pos.x, 6.0f, 9.0f);
+/// Input de um passo a partir das ações do seu intervalo.
+static Input processInput(GLFWwindow *win, const ActionSample &a)
+{
+	Input in;
 
-	bool changed = false;
+	// Movimento horizontal (aplicado somente ao jogador da vez em step())
+	in.move = MOVE_SPEED * (a.heldFor(Action::MoveRight) - a.heldFor(Action::MoveLeft));
 
 	// Ajuste de força e ângulo
-	auto adjust = [&](int key, float &var, float inc, float mn, float mx)
-	{
-		if (glfwGetKey(win, key) == GLFW_PRESS)
-		{
-			var += inc;
-			var = clampf(var, mn, mx);
-			changed = true;
-		}
-	};
-	adjust(GLFW_KEY_UP, power, +0.02f, 1.0f, 20.0f);
-	adjust(GLFW_KEY_DOWN, power, -0.02f, 1.0f, 20.0f);
-	adjust(GLFW_KEY_LEFT, angleDeg, -0.2f, 0.0f, 90.0f);
-	adjust(GLFW_KEY_RIGHT, angleDeg, +0.2f, 0.0f, 90.0f);
+	in.powerDelta = POWER_RATE * (a.heldFor(Action::PowerUp) - a.heldFor(Action::PowerDown));
+	in.angleDelta = ANGLE_RATE * (a.heldFor(Action::AngleUp) - a.heldFor(Action::AngleDown));
 
-	if (changed)
-		std::cout << "Angle=" << angleDeg << "  Force=" << power << "\n";
+	// Disparo: cada aperto conta uma vez (segurar não dispara de novo)
+	in.fire = a.pressed(Action::Fire);
 
-	// Disparo
-	if (glfwGetKey(win, GLFW_KEY_SPACE) == GLFW_PRESS && !inFlight)
-	{
-		inFlight = true;
-		flightTime = 0.0f;
-		if (currentPlayer == 1)
-			launchPositionP1 = {p1.pos.x + 0.5f, p1.pos.y + 0.5f};
-		else
-			launchPositionP2 = {p2.pos.x + 0.5f, p2.pos.y + 0.5f};
+	if (a.pressed(Action::Quit))
+		glfwSetWindowShouldClose(win, true);
+	return in;
+}
 
-		std::cout << "DISPARO do Player " << currentPlayer
-							<< " | Angulo=" << angleDeg << " Forca=" << power << "\n";
+// ╔═══════════════════════════════════════════════════════════════════════════╗
+// ║                        Oponente do Computador                             ║
+// ╚═══════════════════════════════════════════════════════════════════════════╝
+/// Busca a mira (dentro de AI_BUDGET) e devolve o Input que a aplica e dispara.
+static Input aiInput(ShotSolver &solver)
+{
+	const AimSolution aim = solver.solve(game, game.currentPlayer, AI_BUDGET);
+	Input in;
+	in.setAim = true; // exatamente a mira conferida pela busca
+	in.aimAngleDeg = aim.angleDeg;
+	in.aimPower = aim.power;
+	in.fire = true;
+	return in;
+}
+
+// ╔═══════════════════════════════════════════════════════════════════════════╗
+// ║                      Mensagens de Console da Partida                      ║
+// ╚═══════════════════════════════════════════════════════════════════════════╝
+// Vão para o Logger: a escrita no terminal acontece numa thread de fundo e
+// nunca segura o quadro.
+static void reportStep(const Input &in, StepEvent ev)
+{
+	// Com uma seta pressionada isto se repetiria a cada passo de física: os
+	// valores intermediários passam pelo limite, e o final, quando as setas
+	// são soltas, sai sempre (o limite poderia ter engolido o último).
+	static LogRate aimRate(10.0f);
+	static bool aiming = false;
+	if (in.powerDelta != 0.0f || in.angleDelta != 0.0f)
+	{
+		aiming = true;
+		Logger::get().write(aimRate, LogLevel::Info, "Angle=%g  Force=%g", game.angleDeg, game.power);
+	}
+	else if (aiming && ev != StepEvent::Fired)
+	{
+		aiming = false;
+		logInfo("Angle=%g  Force=%g", game.angleDeg, game.power);
 	}
 
-	if (glfwGetKey(win, GLFW_KEY_ESCAPE) == GLFW_PRESS)
-		glfwSetWindowShouldClose(win, true);
+	switch (ev)
+	{
+	case StepEvent::Fired:
+		aiming = false; // a mira final vai nesta mensagem
+		logInfo("DISPARO do Player %d | Angulo=%g Forca=%g", game.currentPlayer, game.angleDeg, game.power);
+		return;
+	case StepEvent::HitBuilding:
+		logInfo("Colidiu em um prédio!");
+		break;
+	case StepEvent::HitPlayer:
+		// O turno já foi trocado: o jogador atingido é o novo jogador da vez.
+		logInfo("Acertou o Jogador %d!", game.currentPlayer);
+		logInfo("Placar -> P1=%d  P2=%d", game.p1.score, game.p2.score);
+		break;
+	case StepEvent::OffMap:
+		logInfo("Projétil saiu do mapa.");
+		break;
+	default:
+		return;
+	}
+	logInfo("Agora é a vez do Jogador %d!", game.currentPlayer);
 }
 
 // ╔═══════════════════════════════════════════════════════════════════════════╗
 // ║                         Funções de Desenho Auxiliares                     ║
 // ╚═══════════════════════════════════════════════════════════════════════════╝
-static void drawQuad(bool blur)
+// Cada função só registra um comando; flushQueue() desenha tudo ordenado
+// por estado (programa, VAO, textura) e troca cada estado uma vez.
+
+/// queue.flush() somando desenhos e trocas de estado em frameDraws.
+static void flushQueue()
 {
-	glDisable(GL_DEPTH_TEST);
-	glBindVertexArray(bgVAO);
-	glUniform1i(uni.useColor, GL_FALSE);
-	glUniform1i(uni.blur, blur);
-	glBindTexture(GL_TEXTURE_2D, texBG);
+	queue.flush(objectRing);
+	const RenderQueue::Stats &st = queue.stats();
+	frameDraws.draws += st.draws;
+	frameDraws.programBinds += st.programBinds;
+	frameDraws.vaoBinds += st.vaoBinds;
+	frameDraws.textureBinds += st.textureBinds;
+	frameDraws.skipped += st.skipped;
+}
 
-	glm::mat4 m(1.0f);
-	glUniformMatrix4fv(uni.model, 1, GL_FALSE, glm::value_ptr(m));
-	glDrawArrays(GL_TRIANGLES, 0, 6);
-	glEnable(GL_DEPTH_TEST);
+/// Profundidade na janela (0 perto, 1 longe) de um ponto em `z`, para a
+/// chave da RenderQueue: com a ortográfica de updateFrameUniforms e view
+/// identidade, z = 1 fica no plano próximo e z = -1 no distante.
+static float depthOf(float z)
+{
+	return (1.0f - z) * 0.5f;
 }
 
-static void drawCube(const glm::vec2 &pos, const glm::vec2 &size, GLuint tex)
+static void drawQuad()
 {
-	glBindVertexArray(cubeVAO);
-	glUniform1i(uni.useColor, GL_FALSE);
-	glBindTexture(GL_TEXTURE_2D, tex);
+	DrawCommand cmd;
+	cmd.layer = RenderLayer::Background; // antes de tudo, atrás de tudo (z = -0.9)
+	cmd.program = gShader->getProgramID();
+	cmd.vao = bgVAO;
+	cmd.texture = texBG;
+	cmd.depth = depthOf(-0.9f);
+	cmd.count = 6; // model identidade, textura
+	queue.submit(cmd);
+}
+
+/// Prédios por instância num buffer fixo: a cidade só muda quando a fase é
+/// criada, então é enviada uma vez e não ocupa o StreamBuffer.
+static void buildCityInstances()
+{
+	std::vector<CubeInstance> city;
+	city.reserve(game.buildings.size());
+	for (const auto &b : game.buildings)
+		city.push_back({glm::vec4(b.pos, b.size), static_cast<float>(LAYER_BUILDING)});
+	cubes.setStatic(city);
+}
+
+/// Um desenho instanciado do array de sprites; cada instância escolhe sua camada.
+static void submitCubes(GLuint vao, GLsizei instances)
+{
+	if (instances <= 0)
+		return;
+
+	DrawCommand cmd;
+	cmd.program = gShader->getProgramID();
+	cmd.vao = vao;
+	cmd.textureTarget = GL_TEXTURE_2D_ARRAY;
+	cmd.texture = sprites.id();
+	cmd.textureUnit = 1;
+	cmd.depth = depthOf(0.5f); // face da frente do cubo unitário
+	cmd.object.instanced = GL_TRUE;
+	cmd.count = 36;
+	cmd.instances = instances;
+	queue.submit(cmd);
+}
+
+/// Prédios (buffer fixo) e jogadores (a cada quadro, no StreamBuffer): dois
+/// glDrawArraysInstanced com o mesmo programa e a mesma textura. Se a fatia
+/// do quadro não couber, os prédios continuam sendo desenhados.
+static void drawCubes()
+{
+	submitCubes(cubes.staticArray(), cubes.staticSize());
 
-	glm::mat4 m(1.0f);
-	m = glm::translate(m, {pos.x + size.x * 0.5f, pos.y + size.y * 0.5f, 0.0f});
-	m = glm::scale(m, {size.x, size.y, 1.0f});
-	glUniformMatrix4fv(uni.model, 1, GL_FALSE, glm::value_ptr(m));
-	glDrawArrays(GL_TRIANGLES, 0, 36);
+	cubes.clear();
+	cubes.add(game.p1.pos, game.p1.size, LAYER_P1);
+	cubes.add(game.p2.pos, game.p2.size, LAYER_P2);
+	cubes.upload();
+	submitCubes(cubes.vertexArray(), cubes.uploadedSize());
 }
 
-static void drawSphere(const glm::vec2 &center, float scale, const glm::vec3 &color)
+static void drawSphere(const GpuMesh &mesh, const glm::vec2 &center, float scale, const glm::vec3 &color)
 {
-	glBindVertexArray(sphereVAO);
-	glUniform1i(uni.useColor, GL_TRUE);
-	glUniform3fv(uni.overrideColor, 1, &color[0]);
+	if (mesh.indexCount <= 0)
+		return;
+
+	DrawCommand cmd;
+	cmd.program = gShader->getProgramID();
+	cmd.vao = mesh.vao;
+	cmd.object.model = glm::translate(cmd.object.model, {center.x, center.y, 0.0f});
+	cmd.object.model = glm::scale(cmd.object.model, {scale, scale, scale});
+	cmd.object.color = glm::vec4(color, 1.0f);
+	cmd.object.useColor = GL_TRUE;
+	cmd.depth = depthOf(mesh.radius * scale); // polo da esfera voltado à câmera
+	cmd.count = mesh.indexCount;
+	cmd.indexType = GL_UNSIGNED_SHORT;
+	queue.submit(cmd);
+}
 
-	glm::mat4 m(1.0f);
-	m = glm::translate(m, {center.x, center.y, 0.0f});
-	m = glm::scale(m, {scale, scale, scale});
-	glUniformMatrix4fv(uni.model, 1, GL_FALSE, glm::value_ptr(m));
-	glDrawArrays(GL_TRIANGLES, 0, sphereVertexCount);
+/// Brilho da explosão: a esfera é desenhada sozinha fora da tela, desfocada
+/// em resolução reduzida (GaussianBlur) e somada à cena com `intensity`.
+/// Chamar depois do flush() da cena.
+static void drawExplosionGlow(const glm::vec2 &center, float scale, const glm::vec3 &color, float intensity)
+{
+	const GLfloat transparent[4] = {0.0f, 0.0f, 0.0f, 0.0f};
+	glowTarget.bind();
+	glClearBufferfv(GL_COLOR, 0, transparent);
+	drawSphere(*explosionMesh, center, scale, color);
+	flushQueue();
+	glBindFramebuffer(GL_FRAMEBUFFER, sceneTarget.fbo);
+	glViewport(0, 0, WIN_WIDTH, WIN_HEIGHT);
 
-	glUniform1i(uni.useColor, GL_FALSE); // restaura
+	compositor.add(bloom.apply(glowTarget.color, BLOOM_RADIUS), intensity);
 }
 
 // ╔═══════════════════════════════════════════════════════════════════════════╗
-// ║                                   main                                    ║
+// ║                          Montagem e Quadro da Cena                        ║
 // ╚═══════════════════════════════════════════════════════════════════════════╝
-int main()
+/// Tudo o que a cena precisa, com o contexto GL já ativo.
+static void buildScene(TextureLoader &textures)
 {
-	// Consoles Windows precisam de setlocale + CP_UTF8 para acentos
-	std::setlocale(LC_ALL, "");
-#ifdef _WIN32
-	SetConsoleOutputCP(CP_UTF8);
-#endif
+	Shader::setBinaryCacheDir("shader_cache"); // pula a compilação de GLSL na 2ª execução em diante
+	createShader();
+	bindSceneUniforms();
+	buildStreamBuffers();
+	loadAllTextures(textures); // decodifica enquanto o resto é preparado
+	buildGeometry();
+	buildPostProcess();
+	initGame(game, "skyline.aim");
+	buildCityInstances();
+}
+
+static void destroyScene(TextureLoader &textures)
+{
+	cubes.destroy();
+	sprites.destroy();
+	sceneTarget.destroy();
+	glowTarget.destroy();
+	bloom.destroy();
+	compositor.destroy();
+	meshes.destroy();
+	stream.destroy();
+	textures.destroy();
+	gShader.reset();
+}
 
+/// Desenha um quadro no framebuffer da cena (a janela ou sceneTarget).
+/// A região do quadro no StreamBuffer só é reescrita quando a GPU a liberar.
+static void renderFrame(Profiler &profiler, const glm::vec2 &projectile, double time)
+{
+	frameDraws = RenderQueue::Stats{};
+	{
+		CpuScope scope(profiler, "sync");
+		stream.beginFrame();
+	}
+	const float t = game.explosionTime / game.explosionDuration;
+	const float r = 0.2f + 1.3f * t;
+	const glm::vec3 color(1.0f, 1.0f - t, 0.0f);
+	{
+		GpuScope scope(profiler, "scene");
+		updateFrameUniforms(time);
+		glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+		drawQuad();											// fundo (já desfocado na carga)
+		drawCubes();									// prédios e jogadores
+		drawSphere(*projectileMesh, projectile, 1.0f, {1, 1, 1}); // projétil
+		if (game.showExplosion)
+			drawSphere(*explosionMesh, {game.explosionX, game.explosionY}, r, color);
+		flushQueue();
+	}
+	if (game.showExplosion)
+	{
+		GpuScope scope(profiler, "glow");
+		drawExplosionGlow({game.explosionX, game.explosionY}, r, color, 1.0f - t);
+	}
+	stream.endFrame();
+}
+
+// ╔═══════════════════════════════════════════════════════════════════════════╗
+// ║                              Partida na Janela                            ║
+// ╚═══════════════════════════════════════════════════════════════════════════╝
+static int runWindowed()
+{
 	GLFWwindow *window = createWindow();
 	if (!window)
 		return -1;
 
-	createShader();
-	buildGeometry();
-	loadAllTextures();
-	initGame();
+	// Um único conjunto de threads: decodifica as texturas no início e depois
+	// serve à busca de tiros da IA.
+	ThreadPool workers;
+	TextureLoader textures(workers, s3tcSupported);
+	buildScene(textures);
+
+	logInfo("Controles: [A/D] mover | Left/Right ajusta Angulo | Up/Down ajusta Forca | Espaco dispara");
+
+	ShotSolver solver(workers);
+
+	// Editar um shader com o jogo aberto o recompila sem travar os quadros.
+	FileWatcher watcher;
+	watcher.add(SCENE_VS);
+	watcher.add(SCENE_FS);
 
-	std::cout << "Controles:\n"
-						<< "[A/D] mover | Left/Right ajusta Angulo | Up/Down ajusta Forca | Espaco dispara\n";
+	InputSystem controls;
+	bindControls(controls);
+	controls.attach(window);
 
-	float lastTime = (float)glfwGetTime();
+	FixedTimestep physicsClock(PHYSICS_HZ);
+	Input aiPending; // mira do computador ainda não consumida por um passo
+	double lastTime = glfwGetTime();
+
+	// Tempos por etapa; resumo e trace (chrome://tracing) gravados ao sair.
+	Profiler profiler;
 
 	while (!glfwWindowShouldClose(window))
 	{
-		float currTime = (float)glfwGetTime();
-		float dt = currTime - lastTime;
+		profiler.beginFrame();
+		CpuScope frameScope(profiler, "frame");
+
+		double currTime = glfwGetTime();
+		double dt = currTime - lastTime;
 		lastTime = currTime;
 
-		processInput(window, dt);
+		{
+			CpuScope scope(profiler, "input");
 
-		// Atualiza lógica de jogo
-		updateProjectile(dt);
-		updateExplosion(dt);
+			// Vez do computador: mira uma única vez por turno, quando a explosão
+			// anterior termina (aiPending.fire evita repetir antes do passo seguinte).
+			if (game.currentPlayer == AI_PLAYER && !game.inFlight && !game.showExplosion && !aiPending.fire)
+				aiPending = aiInput(solver);
+		}
 
-		// Desenha
-		glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
-		drawQuad(true);									// fundo com blur
-		for (const auto &b : buildings) // prédios
-			drawCube(b.pos, b.size, texBuilding);
-		drawCube(p1.pos, p1.size, texP1); // jogadores
-		drawCube(p2.pos, p2.size, texP2);
-		drawSphere({projectileX, projectileY}, 1.0f, {1, 1, 1}); // projétil
-		if (showExplosion)
+		// Atualiza lógica de jogo em passos de duração constante. O tempo real
+		// desde o último consumo é dividido entre os passos do quadro; sem passo,
+		// os eventos esperam na fila pelo quadro seguinte.
 		{
-			float t = explosionTime / explosionDuration;
-			float r = 0.2f + 1.3f * t;
-			drawSphere({explosionX, explosionY}, r, {1.0f, 1.0f - t, 0.0f});
+			CpuScope scope(profiler, "physics");
+			const int steps = physicsClock.advance(dt);
+			const double from = controls.cursor();
+			for (int i = 0; i < steps; ++i)
+			{
+				const double until = from + (currTime - from) * (i + 1) / steps;
+				Input in = processInput(window, controls.consume(until));
+				if (game.currentPlayer == AI_PLAYER)
+				{
+					in = aiPending; // as teclas só são descartadas
+					aiPending = Input{};
+				}
+				reportStep(in, step(game, in, physicsClock.stepSize()));
+			}
 		}
+		const glm::vec2 projectile = interpolatedProjectile(game, physicsClock.alpha());
 
-		glfwSwapBuffers(window);
-		glfwPollEvents();
+		{
+			CpuScope scope(profiler, "assets");
+
+			// Texturas que terminaram de decodificar substituem as provisórias
+			textures.poll();
+
+			// Shaders alterados em disco: recompila em segundo plano e só troca
+			// quando o novo programa linkar (um erro mantém o anterior na tela).
+			for (const std::string &path : watcher.poll())
+				if (gShader->uses(path))
+					gShader->reload();
+			if (gShader->update())
+				bindSceneUniforms();
+		}
+
+		renderFrame(profiler, projectile, currTime);
+
+		{
+			CpuScope scope(profiler, "swap");
+			glfwSwapBuffers(window);
+			glfwPollEvents();
+		}
 	}
 
-	delete gShader;
+	profiler.report(std::cout);
+	if (profiler.writeChromeTrace("profile_trace.json"))
+		logInfo("Trace gravado em profile_trace.json");
+	profiler.destroy();
+
+	destroyScene(textures);
 	glfwTerminate();
 	return 0;
 }
+
+// ╔═══════════════════════════════════════════════════════════════════════════╗
+// ║                      Benchmark de Quadros sem Janela                      ║
+// ╚═══════════════════════════════════════════════════════════════════════════╝
+// `Gorilla --headless N` desenha N quadros de uma partida roteirizada num
+// RenderTarget, sem janela (HeadlessContext), e mede cada quadro do início
+// da simulação ao fim da GPU (glFinish). Serve para acompanhar regressões de
+// desenho em máquinas sem GPU – com o llvmpipe do Mesa os números refletem
+// o custo em software, não o de uma placa de vídeo.
+
+/// Disparos da partida roteirizada (ângulo, força), repetidos em ciclo pelos
+/// dois jogadores: acertos em prédios, no oponente e saídas do mapa.
+static const float kScriptedShots[][2] = {
+		{45.0f, 10.0f}, {60.0f, 12.0f}, {35.0f, 14.0f}, {70.0f, 9.0f},
+		{50.0f, 16.0f}, {30.0f, 8.0f}, {55.0f, 13.0f}, {40.0f, 18.0f}};
+
+/// Percentil p (0..1) de valores já ordenados, por vizinho mais próximo.
+static double percentile(const std::vector<double> &sorted, double p)
+{
+	const size_t i = static_cast<size_t>(p * static_cast<double>(sorted.size() - 1) + 0.5);
+	return sorted[std::min(i, sorted.size() - 1)];
+}
+
+struct HeadlessResult
+{
+	int frames = 0, shots = 0;
+	double min = 0, median = 0, avg = 0, p95 = 0, p99 = 0, max = 0; ///< ms por quadro
+	double draws = 0, programBinds = 0, vaoBinds = 0, textureBinds = 0; ///< médias por quadro
+	int maxDraws = 0;
+	int skipped = 0; ///< desenhos pulados na execução toda (StreamBuffer cheio)
+};
+
+static HeadlessResult summarize(std::vector<double> ms, const std::vector<RenderQueue::Stats> &draws, int shots)
+{
+	HeadlessResult r;
+	r.frames = static_cast<int>(ms.size());
+	r.shots = shots;
+	if (ms.empty())
+		return r;
+
+	std::sort(ms.begin(), ms.end());
+	double sum = 0;
+	for (double v : ms)
+		sum += v;
+	r.min = ms.front();
+	r.max = ms.back();
+	r.avg = sum / static_cast<double>(ms.size());
+	r.median = percentile(ms, 0.5);
+	r.p95 = percentile(ms, 0.95);
+	r.p99 = percentile(ms, 0.99);
+
+	for (const RenderQueue::Stats &d : draws)
+	{
+		r.draws += d.draws;
+		r.programBinds += d.programBinds;
+		r.vaoBinds += d.vaoBinds;
+		r.textureBinds += d.textureBinds;
+		r.maxDraws = std::max(r.maxDraws, d.draws);
+		r.skipped += d.skipped;
+	}
+	const double n = static_cast<double>(draws.size());
+	r.draws /= n;
+	r.programBinds /= n;
+	r.vaoBinds /= n;
+	r.textureBinds /= n;
+	return r;
+}
+
+static void printHeadless(const HeadlessResult &r)
+{
+	std::cout << std::fixed << std::setprecision(3)
+						<< "Quadros: " << r.frames << "  Disparos: " << r.shots << "  (" << WIN_WIDTH << "x" << WIN_HEIGHT << ")\n"
+						<< "Tempo por quadro (ms): min " << r.min << "  mediana " << r.median << "  média " << r.avg
+						<< "  p95 " << r.p95 << "  p99 " << r.p99 << "  max " << r.max << "\n"
+						<< std::setprecision(2)
+						<< "Por quadro (fila de desenho): " << r.draws << " desenhos (máx " << r.maxDraws << "), "
+						<< r.programBinds << " programas, " << r.vaoBinds << " VAOs, " << r.textureBinds << " texturas\n";
+	if (r.skipped > 0)
+		std::cout << "Desenhos pulados (StreamBuffer cheio): " << r.skipped << "\n";
+	std::cout << "  (os passes de brilho – GaussianBlur e Compositor – não passam pela fila)\n";
+}
+
+static bool writeHeadlessJson(const std::string &path, const HeadlessResult &r)
+{
+	std::ofstream out(path, std::ios::binary);
+	if (!out)
+		return false;
+
+	out << std::setprecision(6) << "{\n  \"version\": 1,\n  \"width\": " << WIN_WIDTH << ",\n  \"height\": " << WIN_HEIGHT
+			<< ",\n  \"frames\": " << r.frames << ",\n  \"shots\": " << r.shots
+			<< ",\n  \"frameMs\": {\"min\": " << r.min << ", \"median\": " << r.median << ", \"mean\": " << r.avg
+			<< ", \"p95\": " << r.p95 << ", \"p99\": " << r.p99 << ", \"max\": " << r.max << "}"
+			<< ",\n  \"perFrame\": {\"draws\": " << r.draws << ", \"maxDraws\": " << r.maxDraws
+			<< ", \"programBinds\": " << r.programBinds << ", \"vaoBinds\": " << r.vaoBinds
+			<< ", \"textureBinds\": " << r.textureBinds << "}"
+			<< ",\n  \"skippedDraws\": " << r.skipped << "\n}\n";
+	return static_cast<bool>(out);
+}
+
+static int runHeadless(int frames, const std::string &jsonPath)
+{
+	HeadlessContext context;
+	if (!context.create(4, 4) || !initGL(true))
+		return -1;
+	logInfo("[Headless] %s – %s", reinterpret_cast<const char *>(glGetString(GL_RENDERER)),
+				reinterpret_cast<const char *>(glGetString(GL_VERSION)));
+
+	ThreadPool workers;
+	TextureLoader textures(workers, s3tcSupported);
+	buildScene(textures);
+	sceneTarget.init(WIN_WIDTH, WIN_HEIGHT, true);
+	sceneTarget.bind();
+
+	// Texturas prontas antes do primeiro quadro medido.
+	while (!textures.idle())
+	{
+		if (textures.poll() == 0)
+			std::this_thread::yield();
+	}
+
+	// Tempo simulado fixo: a mesma partida quadro a quadro em qualquer máquina.
+	FixedTimestep physicsClock(PHYSICS_HZ);
+	Profiler profiler;
+	std::vector<double> frameMs;
+	std::vector<RenderQueue::Stats> draws;
+	frameMs.reserve(frames);
+	draws.reserve(frames);
+	int shots = 0;
+
+	for (int f = 0; f < frames; ++f)
+	{
+		const auto start = std::chrono::steady_clock::now();
+		profiler.beginFrame();
+		{
+			CpuScope frameScope(profiler, "frame");
+
+			Input in;
+			if (!game.inFlight && !game.showExplosion)
+			{
+				const float *shot = kScriptedShots[shots % std::size(kScriptedShots)];
+				in.setAim = true;
+				in.aimAngleDeg = shot[0];
+				in.aimPower = shot[1];
+				in.fire = true;
+			}
+			{
+				CpuScope scope(profiler, "physics");
+				const int steps = physicsClock.advance(HEADLESS_DT);
+				for (int i = 0; i < steps; ++i)
+				{
+					if (step(game, in, physicsClock.stepSize()) == StepEvent::Fired)
+						++shots;
+					in = Input{};
+				}
+			}
+			const glm::vec2 projectile = interpolatedProjectile(game, physicsClock.alpha());
+
+			renderFrame(profiler, projectile, f * HEADLESS_DT);
+
+			CpuScope scope(profiler, "finish");
+			glFinish(); // sem swap: espera a GPU para medir o quadro inteiro
+		}
+		frameMs.push_back(std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count());
+		draws.push_back(frameDraws);
+	}
+
+	const HeadlessResult result = summarize(frameMs, draws, shots);
+	printHeadless(result);
+	profiler.report(std::cout);
+	profiler.destroy();
+
+	int status = 0;
+	if (!jsonPath.empty())
+	{
+		if (writeHeadlessJson(jsonPath, result))
+			std::cout << "Resultados gravados em " << jsonPath << "\n";
+		else
+		{
+			std::cerr << "[Headless] Não foi possível gravar " << jsonPath << "\n";
+			status = 1;
+		}
+	}
+
+	destroyScene(textures);
+	return status;
+}
+
+// ╔═══════════════════════════════════════════════════════════════════════════╗
+// ║                                   main                                    ║
+// ╚═══════════════════════════════════════════════════════════════════════════╝
+int main(int argc, char **argv)
+{
+	// Consoles Windows precisam de setlocale + CP_UTF8 para acentos
+	std::setlocale(LC_ALL, "");
+#ifdef _WIN32
+	SetConsoleOutputCP(CP_UTF8);
+#endif
+
+	int headlessFrames = 0;
+	std::string jsonPath;
+	Logger::Options log;
+	for (int i = 1; i < argc; ++i)
+	{
+		const std::string a = argv[i];
+		const bool hasValue = i + 1 < argc;
+		if (a == "--headless" && hasValue)
+			headlessFrames = std::max(1, std::atoi(argv[++i]));
+		else if (a == "--json" && hasValue)
+			jsonPath = argv[++i];
+		else if (a == "--log-level" && hasValue && parseLogLevel(argv[i + 1], log.level))
+			++i;
+		else if (a == "--log-file" && hasValue)
+			log.binaryPath = argv[++i];
+		else
+		{
+			std::cerr << "Uso: Gorilla [--headless quadros [--json saida.json]]"
+									 " [--log-level debug|info|warn|error|off] [--log-file log.glog]\n";
+			return 1;
+		}
+	}
+
+	Logger::get().start(log);
+	const int status = (headlessFrames > 0) ? runHeadless(headlessFrames, jsonPath) : runWindowed();
+	Logger::get().stop();
+	return status;
+}
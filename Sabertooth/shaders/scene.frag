@@ -0,0 +1,28 @@
+#version 440 core
+in vec2 vUV;
+flat in float vLayer;
+out vec4 FragColor;
+uniform sampler2D tex;
+uniform sampler2DArray sprites; // unidade 1: prédios e jogadores
+
+layout(std140) uniform Object {
+    mat4 model;
+    vec4 color;     // cor sólida, se useColor
+    int useColor;
+    int instanced;
+};
+
+void main() {
+    if (useColor != 0) {
+        FragColor = color;
+        return;
+    }
+
+    vec4 texel = instanced != 0 ? texture(sprites, vec3(vUV, vLayer))
+                           : texture(tex, vUV);
+
+    // Transparência real – descarta fundo branco
+    if (texel.a < 0.1) discard;
+
+    FragColor = texel;
+}
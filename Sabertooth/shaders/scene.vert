@@ -0,0 +1,35 @@
+#version 440 core
+// Cena: fundo, esferas (model) e cubos por instância (instanced).
+// Salvar este arquivo com o jogo aberto recompila e troca o programa.
+layout(location=0) in vec3 aPos;
+layout(location=1) in vec2 aUV;
+layout(location=2) in vec4 iRect;  // por instância: base xy + tamanho
+layout(location=3) in float iLayer; // por instância: camada de textura
+out vec2 vUV;
+flat out float vLayer;
+
+// Blocos std140 (structs FrameUniforms / ObjectUniforms em UniformBuffers.h)
+layout(std140) uniform Frame {
+    mat4 view;
+    mat4 projection;
+    float time;
+};
+layout(std140) uniform Object {
+    mat4 model;
+    vec4 color;
+    int useColor;
+    int instanced;
+};
+
+void main() {
+    vUV = aUV;
+    vLayer = iLayer;
+    vec3 p = aPos;
+    mat4 m = model;
+    if (instanced != 0) {
+        // Mesmo translate(centro) * scale(tamanho) de drawCube
+        p = vec3(aPos.xy * iRect.zw + iRect.xy + 0.5 * iRect.zw, aPos.z);
+        m = mat4(1.0);
+    }
+    gl_Position = projection * view * m * vec4(p, 1.0);
+}